@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/message/types.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace prefetch
+{
+
+/**
+ * @brief The D-Bus property value types which are prefetched
+ *
+ * @note The properties of the other types are skipped while prefetching.
+ */
+using PropertyValue =
+    std::variant<std::string, bool, uint8_t, uint16_t, uint32_t, uint64_t,
+                 int64_t, double, std::vector<std::string>,
+                 std::vector<uint8_t>>;
+
+/**
+ * @brief Used to prefetch the D-Bus data which are required to restore
+ *        the isolated hardwares in bulk instead of the D-Bus call for
+ *        each lookup.
+ *
+ * @param[in] bus - Bus to attach to.
+ *
+ * @return NULL
+ *
+ * @details Below data are prefetched,
+ *          * The inventory subtree from the mapper to get the service name
+ *            and the child inventory objects.
+ *          * The inventory manager objects to get the inventory properties
+ *            and the FRU inventory objects by the unexpanded location code.
+ *
+ * @note * The prefetched data are used only in the restore path (that is,
+ *         only while the RestoreScope is active in the calling thread)
+ *         and must be released once the restore is finished since
+ *         the D-Bus data can be changed at the runtime.
+ *       * The lookup will return empty optional if the data is not
+ *         prefetched so, the caller must fallback to the D-Bus call.
+ *       * The lookups can be used concurrently (for example, from
+ *         the restore workers) but, the prefetch and release must be
+ *         done only from the main thread while no lookup is in progress.
+ */
+void prefetchRestoreData(sdbusplus::bus::bus& bus);
+
+/**
+ * @class RestoreScope
+ *
+ * @brief Used to mark the restore path in the calling thread to use
+ *        the prefetched D-Bus data.
+ *
+ * @details The lookups return the prefetched data only while the scope
+ *          is active in the calling thread so that the runtime paths
+ *          (which might be run from the event loop while the restore is
+ *          in progress) always get the D-Bus data from their services.
+ */
+class RestoreScope
+{
+  public:
+    RestoreScope();
+    ~RestoreScope();
+
+    RestoreScope(const RestoreScope&) = delete;
+    RestoreScope& operator=(const RestoreScope&) = delete;
+    RestoreScope(RestoreScope&&) = delete;
+    RestoreScope& operator=(RestoreScope&&) = delete;
+};
+
+/**
+ * @brief Used to release the prefetched D-Bus data
+ *
+ * @return NULL
+ */
+void release();
+
+/**
+ * @brief Used to get the prefetched service name of the given object
+ *        and interface.
+ *
+ * @param[in] objPath - The D-Bus object path.
+ * @param[in] interface - The D-Bus interface name.
+ *
+ * @return The service name on success
+ *         Empty optional if not prefetched or not in the restore scope
+ */
+std::optional<std::string> getServiceName(const std::string& objPath,
+                                          const std::string& interface);
+
+/**
+ * @brief Used to get the prefetched property value
+ *
+ * @param[in] objPath - The D-Bus object path.
+ * @param[in] interface - The D-Bus interface name of the property.
+ * @param[in] propName - The D-Bus property name.
+ *
+ * @return The property value on success
+ *         nullptr if not prefetched or not in the restore scope
+ */
+const PropertyValue* getPropertyValue(const std::string& objPath,
+                                      const std::string& interface,
+                                      const std::string& propName);
+
+/**
+ * @brief Used to get the prefetched property value as T type
+ *
+ * @return The property value on success
+ *         Empty optional if not prefetched, not in the restore scope
+ *         or the type is different
+ */
+template <typename T>
+std::optional<T> getProperty(const std::string& objPath,
+                             const std::string& interface,
+                             const std::string& propName)
+{
+    constexpr bool isPrefetchedType = []<typename... Ts>(std::variant<Ts...>*) {
+        return (std::is_same_v<T, Ts> || ...);
+    }(static_cast<PropertyValue*>(nullptr));
+
+    if constexpr (isPrefetchedType)
+    {
+        auto propVal = getPropertyValue(objPath, interface, propName);
+        if (propVal != nullptr)
+        {
+            if (auto val = std::get_if<T>(propVal); val != nullptr)
+            {
+                return *val;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Used to get the prefetched child objects of the given parent object
+ *        which are implemented the given interface.
+ *
+ * @param[in] parentObjPath - The parent D-Bus object path.
+ * @param[in] interface - The child D-Bus interface name.
+ *
+ * @return The child object paths on success
+ *         Empty optional if not prefetched or not in the restore scope
+ */
+std::optional<std::vector<sdbusplus::message::object_path>>
+    getSubTreePaths(const std::string& parentObjPath,
+                    const std::string& interface);
+
+/**
+ * @brief Used to get the prefetched FRU inventory objects by using
+ *        the given unexpanded location code.
+ *
+ * @param[in] unexpandedLocCode - The unexpanded location code.
+ *
+ * @return The FRU inventory object paths on success
+ *         Empty optional if not prefetched or not in the restore scope
+ */
+std::optional<std::vector<sdbusplus::message::object_path>>
+    getFRUsByUnexpandedLocCode(const std::string& unexpandedLocCode);
+
+} // namespace prefetch
+} // namespace hw_isolation
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "hw_isolation_record/openpower_guard_interface.hpp"
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace devtree
+{
+
+/**
+ * @class EntityPathKey
+ *
+ * @brief Fixed-size key of the hardware entity path
+ *
+ * @details The raw entity path (type_size followed by the targetType and
+ *          instance pair of each path element) is at most 21 bytes so, it is
+ *          kept inline to use as the lookup key instead of converting into
+ *          the DevTreePhysPath (std::vector) which allocates for every
+ *          conversion.
+ *
+ * @note The unused trailing bytes are always zero so the whole buffer
+ *       can be used to compare and hash.
+ */
+class EntityPathKey
+{
+  public:
+    static constexpr std::size_t maxPathElements = 10;
+    static constexpr std::size_t maxSize = 1 + (maxPathElements * 2);
+
+    using RawData = std::array<uint8_t, maxSize>;
+
+    constexpr EntityPathKey() = default;
+
+    /**
+     * @brief Constructor to build the key from the raw entity path
+     *        (aka ATTR_PHYS_BIN_PATH) data.
+     *
+     * @param[in] rawData - the raw entity path data
+     * @param[in] size - the raw entity path data size
+     */
+    constexpr EntityPathKey(const uint8_t* rawData, std::size_t size)
+    {
+        std::copy_n(rawData, std::min(size, maxSize), _rawData.begin());
+        normalize();
+    }
+
+    /**
+     * @brief Constructor to build the key from the libguard entity path.
+     *
+     * @param[in] entityPath - the hardware entity path
+     */
+    explicit EntityPathKey(const openpower_guard::EntityPath& entityPath)
+    {
+        _rawData[0] = entityPath.type_size;
+
+        // PathElement targetType and instance are uint8_t,
+        // refer devtree::convertEntityPathIntoRawData().
+        for (std::size_t i = 0; i < elements(); i++)
+        {
+            _rawData[1 + (i * 2)] = entityPath.pathElements[i].targetType;
+            _rawData[2 + (i * 2)] = entityPath.pathElements[i].instance;
+        }
+    }
+
+    /**
+     * @brief Used to get the number of valid path elements.
+     */
+    constexpr std::size_t elements() const
+    {
+        // Path elements size stored at last 4bits in type_size member.
+        return std::min<std::size_t>(_rawData[0] & 0x0F, maxPathElements);
+    }
+
+    /**
+     * @brief Used to get the number of valid raw data bytes.
+     */
+    constexpr std::size_t size() const
+    {
+        return 1 + (elements() * 2);
+    }
+
+    constexpr const uint8_t* data() const
+    {
+        return _rawData.data();
+    }
+
+    /**
+     * @brief Used to get the key as DevTreePhysPath to persist or to pass
+     *        the APIs which are still using the DevTreePhysPath.
+     */
+    std::vector<uint8_t> toRawData() const
+    {
+        return std::vector<uint8_t>(_rawData.begin(),
+                                    _rawData.begin() + size());
+    }
+
+    /**
+     * @brief Used to get the key as libguard entity path.
+     */
+    openpower_guard::EntityPath toEntityPath() const
+    {
+        return openpower_guard::EntityPath(data(), size());
+    }
+
+    /**
+     * @brief Used to get the key as hex string to trace.
+     */
+    std::string toString() const
+    {
+        std::string str;
+        std::for_each(_rawData.begin(), _rawData.begin() + size(),
+                      [&str](const auto& ele) {
+            str.append(std::format("{:02x} ", ele));
+        });
+        return str;
+    }
+
+    /**
+     * @brief FNV-1a hash of the key
+     */
+    constexpr std::size_t hash() const
+    {
+        uint64_t hashVal{0xcbf29ce484222325ULL};
+        for (const auto& ele : _rawData)
+        {
+            hashVal ^= ele;
+            hashVal *= 0x100000001b3ULL;
+        }
+        return static_cast<std::size_t>(hashVal);
+    }
+
+    constexpr bool operator==(const EntityPathKey&) const = default;
+    constexpr auto operator<=>(const EntityPathKey&) const = default;
+
+  private:
+    /** @brief The raw entity path data */
+    RawData _rawData{};
+
+    /**
+     * @brief Helper to clear the bytes which are not part of the valid
+     *        path elements.
+     */
+    constexpr void normalize()
+    {
+        std::fill(_rawData.begin() + size(), _rawData.end(), 0);
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<EntityPathKey>);
+static_assert(sizeof(EntityPathKey) == EntityPathKey::maxSize);
+
+} // namespace devtree
+} // namespace hw_isolation
+
+template <>
+struct std::hash<hw_isolation::devtree::EntityPathKey>
+{
+    constexpr std::size_t
+        operator()(const hw_isolation::devtree::EntityPathKey& key) const
+    {
+        return key.hash();
+    }
+};
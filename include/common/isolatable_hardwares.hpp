@@ -5,8 +5,13 @@
 #include "common_types.hpp"
 #include "phal_devtree_utils.hpp"
 
+#include <sdbusplus/bus/match.hpp>
+
 #include <map>
+#include <memory>
 #include <optional>
+#include <unordered_set>
+#include <vector>
 
 namespace hw_isolation
 {
@@ -207,10 +212,175 @@ class IsolatableHWs
     std::optional<devtree::DevTreePhysPath>
         getPhysicalPath(const sdbusplus::message::object_path& isolateHardware);
 
+    /**
+     * @brief InventoryPathPlan used to hold the isolated hardware details
+     *        which are looked up from the phal cec device tree to get
+     *        the inventory path from the bmc inventory.
+     *
+     * @note The plan doesn't refer the phal cec device tree so, it can be
+     *       resolved without the device tree access, for example, from
+     *       the worker thread.
+     */
+    struct InventoryPathPlan
+    {
+        /**
+         * @brief The isolated hardware device tree path to trace
+         */
+        std::string devTreePath;
+
+        /**
+         * @brief Used to indicate whether the isolated hardware is FRU
+         */
+        bool isItFRU{true};
+
+        /**
+         * @brief The isolated FRU details (or the parent FRU details if
+         *        the isolated hardware is not FRU) and the lookup function
+         *        to get the FRU inventory path.
+         *
+         * @note Empty if the parent FRU is not modelled in the phal cec
+         *       device tree (for example, the oscrefclk parent FRU).
+         */
+        std::optional<std::pair<LocationCode, InstanceId>> fruDetails;
+        inv_path_lookup_func::LookupFuncForInvPath fruInvPathLookupFunc;
+
+        /**
+         * @brief The isolated hardware (not FRU) details to get
+         *        the inventory path under the parent FRU.
+         */
+        std::string childIfaceName;
+        inv_path_lookup_func::UniqueHwId uniqueHwId;
+        inv_path_lookup_func::LookupFuncForInvPath invPathLookupFunc;
+
+        /**
+         * @brief The PrettyName type and suffix to use if more than one
+         *        identical hardware is having the same location code.
+         */
+        std::optional<std::pair<std::string, std::string>> prettyNameSuffix;
+    };
+
+    /**
+     * @brief ResolveCache used to share the parent FRU and its childs
+     *        inventory paths between the plans which are resolved together.
+     *
+     * @note The cache must not be kept once the plans are resolved since
+     *       the inventory can be changed at the runtime.
+     */
+    struct ResolveCache
+    {
+        std::map<std::pair<LocationCode, InstanceId>,
+                 std::optional<sdbusplus::message::object_path>>
+            fruPaths;
+
+        // The clock parent FRU is not modelled in the phal cec device tree
+        std::optional<std::optional<sdbusplus::message::object_path>>
+            clkParentFruPath;
+
+        std::map<std::pair<std::string, std::string>,
+                 std::optional<std::vector<sdbusplus::message::object_path>>>
+            childsInventoryPaths;
+    };
+
+    /**
+     * @brief Used to get the plan to get the inventory path of isolated
+     *        hardware by using the phal cec device tree.
+     *
+     * @param[in] physicalPath - The physical path key of isolated hardware
+     * @param[in|out] persistedCoreEcoMode - Used to indicate or get the core
+     *                                       eco mode.
+     *
+     * @return The inventory path plan on success
+     *         Empty optional on failure
+     */
+    std::optional<InventoryPathPlan>
+        getInventoryPathPlan(const devtree::EntityPathKey& physicalPath,
+                             bool& persistedCoreEcoMode);
+
+    /**
+     * @brief Used to resolve the given plan into the inventory path of
+     *        isolated hardware by using the bmc inventory.
+     *
+     * @param[in] bus - Bus to use to get the inventory details.
+     * @param[in] plan - The inventory path plan to resolve.
+     *
+     * @return The isolated hardware inventory path on success
+     *         Empty optional on failure
+     *
+     * @note It doesn't access the phal cec device tree and the given bus
+     *       is used instead of the attached bus so, it can be called from
+     *       the worker thread by using the private bus connection.
+     */
+    std::optional<sdbusplus::message::object_path>
+        resolveInventoryPath(sdbusplus::bus::bus& bus,
+                             const InventoryPathPlan& plan) const;
+
+    /**
+     * @brief Used to resolve the given plan by using the given cache
+     *        to share the parent FRU lookups with the other plans.
+     *
+     * @param[in] bus - Bus to use to get the inventory details.
+     * @param[in] plan - The inventory path plan to resolve.
+     * @param[in|out] cache - The cache to use and update.
+     *
+     * @return The isolated hardware inventory path on success
+     *         Empty optional on failure
+     */
+    std::optional<sdbusplus::message::object_path>
+        resolveInventoryPath(sdbusplus::bus::bus& bus,
+                             const InventoryPathPlan& plan,
+                             ResolveCache& cache) const;
+
+    /**
+     * @brief Used to get the inventory path of the given isolated hardwares
+     *
+     * @param[in] physPaths - The physical path key of isolated hardwares
+     *
+     * @return The inventory path (empty optional on failure) of the given
+     *         hardwares in the same order.
+     *
+     * @note * The given hardwares are grouped by the parent FRU so that
+     *         the parent FRU and its childs are looked up only once for
+     *         all the hardwares which are in the same FRU.
+     *       * The persisted core eco mode is not considered.
+     *       * The known unresolved hardwares are not resolved again.
+     */
+    std::vector<std::optional<sdbusplus::message::object_path>>
+        resolveMany(const std::vector<devtree::EntityPathKey>& physPaths);
+
+    /**
+     * @brief Used to check whether the inventory path of the given hardware
+     *        is already failed to resolve with the current inventory.
+     *
+     * @param[in] physicalPath - The physical path key of the hardware
+     *
+     * @return true if known unresolved hardware false otherwise.
+     *
+     * @note The caller can use it to skip the hardware quietly instead of
+     *       resolving again and adding the same error logs.
+     */
+    bool isKnownUnresolved(const devtree::EntityPathKey& physicalPath);
+
+    /**
+     * @brief Used to keep the given hardware as unresolved until
+     *        the inventory is changed.
+     *
+     * @param[in] physicalPath - The physical path key of the hardware
+     *
+     * @return NULL
+     */
+    void setUnresolved(const devtree::EntityPathKey& physicalPath);
+
+    /**
+     * @brief Used to retry all the unresolved hardwares
+     *
+     * @return NULL
+     */
+    void invalidateUnresolved();
+
     /**
      * @brief Used to get the inventory path of isolated hardware
      *
-     * @param[in] physicalPath - The physical path of isolated hardware
+     * @param[in] physicalPath - The physical path key of isolated hardware
      * @param[in|out] persistedCoreEcoMode - Used to indicate or get the core
      *                                       eco mode.
      *
@@ -218,7 +388,7 @@ class IsolatableHWs
      *         Empty optional on failure
      */
     std::optional<sdbusplus::message::object_path>
-        getInventoryPath(const devtree::DevTreePhysPath& physicalPath,
+        getInventoryPath(const devtree::EntityPathKey& physicalPath,
                          bool& persistedCoreEcoMode);
 
   private:
@@ -232,6 +402,18 @@ class IsolatableHWs
      */
     std::multimap<HW_Details::HwId, HW_Details> _isolatableHWsList;
 
+    /**
+     * @brief The hardwares which inventory path could not be resolved
+     *        with the current inventory.
+     */
+    std::unordered_set<devtree::EntityPathKey> _unresolvedHws;
+
+    /**
+     * @brief The list of D-Bus match objects to detect the inventory change
+     */
+    std::vector<std::unique_ptr<sdbusplus::bus::match::match>>
+        _inventoryWatchers;
+
     /**
      * @brief Get the HwID based on given ItemInterfaceName or
      *        PhalPdbgClassName.
@@ -299,6 +481,7 @@ class IsolatableHWs
      * @brief Used to get the list of inventory object path by using
      *        given unexpanded location code
      *
+     * @param[in] bus - Bus to use to get the inventory object path
      * @param[in] unexpandedLocCode - The unexpanded location code to get
      *                                the list of inventory object path
      *
@@ -306,7 +489,8 @@ class IsolatableHWs
      *         Empty optional on failure
      */
     std::optional<std::vector<sdbusplus::message::object_path>>
-        getInventoryPathsByLocCode(const LocationCode& unexpandedLocCode);
+        getInventoryPathsByLocCode(sdbusplus::bus::bus& bus,
+                                   const LocationCode& unexpandedLocCode) const;
 
     /**
      * @brief Used to get the parent fru phal cec device tree target
@@ -325,6 +509,7 @@ class IsolatableHWs
      * @brief Used to get the FRU inventory path by using the given
      *        FRU details (location code and instance id)
      *
+     * @param[in] bus - Bus to use to get the inventory path
      * @param[in] fruDetails - The FRU details to get inventory path
      * @param[in] fruInvPathLookupFunc - The lookup function to get inventory
      *                                   path
@@ -333,13 +518,17 @@ class IsolatableHWs
      *         Empty optional on failure
      */
     std::optional<sdbusplus::message::object_path> getFRUInventoryPath(
+        sdbusplus::bus::bus& bus,
         const std::pair<LocationCode, InstanceId>& fruDetails,
-        const inv_path_lookup_func::LookupFuncForInvPath& fruInvPathLookupFunc);
+        const inv_path_lookup_func::LookupFuncForInvPath& fruInvPathLookupFunc)
+        const;
 
     /**
      * @brief Used to get the clock parent fru inventory object path
      *
-     * @param[in] clkTgt - The clock target to get parent fru path
+     * @param[in] bus - Bus to use to get the inventory path
+     * @param[in] clkTgtDevTreePath - The clock target device tree path
+     *                                to trace
      *
      * @return The clock parent fru inventory object path on success
      *         Empty optional on failure
@@ -349,19 +538,20 @@ class IsolatableHWs
      *       instead of defining the isolatable hardwares list.
      */
     std::optional<sdbusplus::message::object_path>
-        getClkParentFruObjPath(struct pdbg_target* clkTgt);
+        getClkParentFruObjPath(sdbusplus::bus::bus& bus,
+                               const std::string& clkTgtDevTreePath) const;
 
     /**
-     * @brief Used to get the parent fru inventory object path of the given
-     *        child target (aka phal cec device tree target)
+     * @brief Used to add the parent fru details of the given child target
+     *        (aka phal cec device tree target) into the given plan
      *
-     * @param[in] childTgt - The child target to get parent fru path
+     * @param[in] childTgt - The child target to get parent fru details
+     * @param[out] plan - The inventory path plan to add parent fru details
      *
-     * @return The parent fru inventory object path on success
-     *         Empty optional on failure
+     * @return true on success false otherwise.
      */
-    std::optional<sdbusplus::message::object_path>
-        getParentFruObjPath(struct pdbg_target* childTgt);
+    bool addParentFruToPlan(struct pdbg_target* childTgt,
+                            InventoryPathPlan& plan);
 };
 
 } // namespace isolatable_hws
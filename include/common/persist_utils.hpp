@@ -0,0 +1,230 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/event.hpp>
+#include <sdeventplus/utility/timer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+
+namespace hw_isolation
+{
+namespace persist
+{
+
+namespace fs = std::filesystem;
+
+constexpr auto HW_ISOLATION_PERSIST_PATH =
+    "/var/lib/op-hw-isolation/persistdata";
+
+/**
+ * @brief Used to get the CRC32 (IEEE 802.3) checksum of the given data
+ *
+ * @param[in] data - the data to get the checksum
+ * @param[in] size - the data size
+ * @param[in] crc - the checksum of the preceding data to continue
+ *                  the checksum. By default, it is "0" to start.
+ *
+ * @return the CRC32 checksum
+ */
+uint32_t crc32(const uint8_t* data, std::size_t size, uint32_t crc = 0);
+
+/**
+ * @brief Used to get the hash (64-bit FNV-1a) of the given file content
+ *
+ * @param[in] path - the file path to get the hash
+ *
+ * @return the file content hash on success
+ *         Empty optional if failed to read the file
+ *
+ * @note It is used to identify whether the file content is changed,
+ *       not for the security purpose.
+ */
+std::optional<uint64_t> hashFile(const fs::path& path);
+
+/**
+ * @brief Used to replace the given file with the given data atomically
+ *        and durably.
+ *
+ * @param[in] path - the file path to replace
+ * @param[in] data - the data to write
+ *
+ * @return true on success false otherwise.
+ *
+ * @note It writes into the temporary file, flushes it and renames over
+ *       the given file so, the given file will have either the old data or
+ *       the new data even if the power is lost while replacing.
+ */
+bool writeFileAtomically(const fs::path& path, const std::string& data);
+
+/**
+ * @class GroupCommit
+ *
+ * @brief Used to make the persisted data durable in batches.
+ *
+ * @details * The persisted objects are scheduling their writer instead of
+ *            writing immediately and all the scheduled writers are executed
+ *            once the event loop is idle.
+ *          * The files are replaced by using the temporary files that are
+ *            renamed after the data of the batch is flushed so, the power
+ *            loss cannot leave the partially written file.
+ *          * The data of the whole batch (the staged files and the data
+ *            which are updated in place, for example, the journal and
+ *            mapped files) is flushed before renaming and the batch is
+ *            retried later if the flush is failed.
+ */
+class GroupCommit
+{
+  public:
+    /**
+     * @brief The writer to persist the object data
+     */
+    using Writer = std::function<void()>;
+
+    /**
+     * @brief The syncer to flush the data which are updated in place
+     *
+     * @return true on success false otherwise.
+     */
+    using Syncer = std::function<bool()>;
+
+    GroupCommit() = delete;
+    GroupCommit(const GroupCommit&) = delete;
+    GroupCommit& operator=(const GroupCommit&) = delete;
+    GroupCommit(GroupCommit&&) = delete;
+    GroupCommit& operator=(GroupCommit&&) = delete;
+
+    /**
+     * @brief Destructor to commit the already staged files of the
+     *        current batch.
+     *
+     * @note The scheduled writers are dropped since those might be using
+     *       the destroyed objects so, the owner must commit before
+     *       destroying the objects which are used by the writers.
+     */
+    ~GroupCommit();
+
+    /**
+     * @brief Constructor to commit the batches in the given event loop.
+     *
+     * @param[in] eventLoop - the event loop to commit
+     * @param[in] path - the persisted data root directory
+     */
+    GroupCommit(const sdeventplus::Event& eventLoop, const std::string& path);
+
+    /**
+     * @brief Used to schedule the given writer into the current batch
+     *
+     * @param[in] name - the unique name of the persisted object
+     * @param[in] writer - the writer to persist the object
+     *
+     * @return NULL
+     *
+     * @note The object which is scheduled more than once in the same
+     *       batch will be written only once by using the last writer.
+     */
+    void schedule(const std::string& name, Writer&& writer);
+
+    /**
+     * @brief Used to request the sync in the current batch for the data
+     *        which are updated in place.
+     *
+     * @param[in] name - the unique name of the persisted object
+     * @param[in] syncer - the syncer to flush the object data
+     *
+     * @return NULL
+     */
+    void requestSync(const std::string& name, Syncer&& syncer);
+
+    /**
+     * @brief Used to flush the requested sync of the given object
+     *        immediately instead of in the current batch.
+     *
+     * @param[in] name - the unique name of the persisted object
+     *
+     * @return NULL
+     *
+     * @note The object must use it before releasing the data which are
+     *       used by its syncer.
+     */
+    void syncNow(const std::string& name);
+
+    /**
+     * @brief Used to stage the given file data to replace
+     *        while committing the current batch.
+     *
+     * @param[in] path - the file path to replace
+     * @param[in] data - the file data
+     *
+     * @return NULL
+     */
+    void stageFile(const fs::path& path, const std::string& data);
+
+    /**
+     * @brief Used to remove the given file in the current batch.
+     *
+     * @param[in] path - the file path to remove
+     *
+     * @return NULL
+     */
+    void stageRemove(const fs::path& path);
+
+    /**
+     * @brief Used to commit the current batch
+     *
+     * @return NULL
+     *
+     * @note It is invoked from the event loop once the loop is idle,
+     *       the caller can use it to commit immediately.
+     */
+    void commit();
+
+  private:
+    /** @brief The event source to commit once the event loop is idle */
+    sdeventplus::source::Defer _commitSource;
+
+    /** @brief The timer to retry the batch which is failed to flush */
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic> _retryTimer;
+
+    /** @brief The scheduled writers in the current batch */
+    std::map<std::string, Writer> _writers;
+
+    /** @brief The staged files to rename in the current batch */
+    std::set<fs::path> _stagedFiles;
+
+    /** @brief The directories which entries are updated in the current
+     *         batch */
+    std::set<fs::path> _updatedDirs;
+
+    /** @brief The requested syncers in the current batch */
+    std::map<std::string, Syncer> _syncers;
+
+    /**
+     * @brief Used to enable the commit event source for the current batch
+     *
+     * @return NULL
+     */
+    void arm();
+
+    /**
+     * @brief Used to flush the current batch data and rename the staged
+     *        files.
+     *
+     * @return true on success false otherwise.
+     *
+     * @note The staged files are not renamed and the failed syncers are
+     *       kept to retry if the batch data is failed to flush.
+     */
+    bool commitBatch();
+};
+
+} // namespace persist
+} // namespace hw_isolation
@@ -8,6 +8,7 @@ extern "C"
 }
 
 #include "common/common_types.hpp"
+#include "common/entity_path_key.hpp"
 #include "hw_isolation_record/openpower_guard_interface.hpp"
 
 #include <functional>
@@ -70,6 +71,34 @@ DevTreePhysPath getPhysicalPath(struct pdbg_target* isolateHw);
 std::optional<struct pdbg_target*>
     getPhalDevTreeTgt(const DevTreePhysPath& physicalPath);
 
+/**
+ * @brief Used to get phal cec device tree target based on
+ *        the given hardware physical path key which is isolated
+ *
+ * @param[in] physicalPath - the hardware physical path key to get
+ *                           the phal cec device tree target
+ *
+ * @return The phal cec device tree target on success
+ *         Empty optional on failure
+ *
+ * @note The lookup is served from the physical path index, which is
+ *       built on the first lookup if buildPhysPathIndex() is not called.
+ */
+std::optional<struct pdbg_target*>
+    getPhalDevTreeTgt(const EntityPathKey& physicalPath);
+
+/**
+ * @brief Used to build the index of the phal cec device tree targets
+ *        by using their physical path (aka ATTR_PHYS_BIN_PATH) to avoid
+ *        the cec device tree traversal for every lookup.
+ *
+ * @return NULL
+ *
+ * @note The phal cec device tree is not changed once it is initialized
+ *       so the index will build only once.
+ */
+void buildPhysPathIndex();
+
 /**
  * @brief Used to get the FRU information (location code and instance id)
  *        from the phal cec device tree by using phal cec device tree target
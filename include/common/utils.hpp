@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "common/dbus_prefetch.hpp"
 #include "common_types.hpp"
 
 #include <phosphor-logging/elog-errors.hpp>
@@ -56,6 +57,13 @@ T getDBusPropertyVal(sdbusplus::bus::bus& bus, const std::string& objPath,
                      const std::string& propInterface,
                      const std::string& propName)
 {
+    if (auto prefetchedVal =
+            prefetch::getProperty<T>(objPath, propInterface, propName);
+        prefetchedVal.has_value())
+    {
+        return *prefetchedVal;
+    }
+
     T propertyVal;
     try
     {
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "common/common_types.hpp"
+#include "hw_isolation_event/event_store.hpp"
 
 #include <cereal/access.hpp>
 #include <cereal/cereal.hpp>
@@ -26,6 +27,11 @@ using EventMsg = std::string;
 using AssociationDefInterface =
     sdbusplus::xyz::openbmc_project::Association::server::Definitions;
 
+/**
+ * @brief The event persisted path which was used before the event store.
+ *
+ * @note It is used only to migrate the persisted events into the event store.
+ */
 constexpr auto HW_ISOLATION_EVENT_PERSIST_PATH =
     "/var/lib/op-hw-isolation/persistdata/event/hw_status/{}";
 
@@ -53,6 +59,7 @@ class Event : public type::ServerObject<EventInterface, AssociationDefInterface>
      *
      *  @param[in] bus - bus to attach with dbus event object path.
      *  @param[in] objPath - event dbus object path to attach.
+     *  @param[in] eventStore - the store to persist the event.
      *  @param[in] eventId - the dbus event id.
      *  @param[in] eventSeverity - the severity of the event.
      *  @param[in] eventMsg - the message of the event
@@ -62,28 +69,49 @@ class Event : public type::ServerObject<EventInterface, AssociationDefInterface>
      *                              deserialize. By default it will serialize.
      */
     Event(sdbusplus::bus::bus& bus, const std::string& objPath,
-          const EventId eventId, const EventSeverity eventSeverity,
-          const EventMsg& eventMsg, const type::AssociationDef& associationDef,
+          EventStore& eventStore, const EventId eventId,
+          const EventSeverity eventSeverity, const EventMsg& eventMsg,
+          const type::AssociationDef& associationDef,
           const bool reqDeserialize = false);
 
     /**
-     * @brief Used to serialize Event members.
+     * @brief Used to serialize Event members into the event store.
      *
      * @return NULL
      */
     void serialize();
 
     /**
-     * @brief Used to Deserialize Event members.
+     * @brief Used to Deserialize Event members from the event store.
      *
      * @return NULL
      */
     void deserialize();
 
+    /**
+     * @brief Used to update the event members if they are different
+     *        from the given details.
+     *
+     * @param[in] eventSeverity - the severity of the event.
+     * @param[in] eventMsg - the message of the event
+     * @param[in] associationDef - the association to hold other dbus
+     *                             object path along with event object.
+     *
+     * @return true if the event is updated else false.
+     *
+     * @note The timestamp will be updated and the event will be serialized
+     *       only if the event is updated.
+     */
+    bool update(const EventSeverity eventSeverity, const EventMsg& eventMsg,
+                const type::AssociationDef& associationDef);
+
   private:
     /** @brief Attached bus connection */
     sdbusplus::bus::bus& _bus;
 
+    /** @brief The store to persist this event */
+    EventStore& _eventStore;
+
     /** @brief The id of isolated hardware dbus event */
     EventId _eventId;
 
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/persist_utils.hpp"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace event
+{
+
+using EventId = uint32_t;
+
+/**
+ * @brief The serialized event members to persist
+ */
+using EventPayload = std::string;
+
+constexpr auto HW_ISOLATION_EVENT_STORE_PATH =
+    "/var/lib/op-hw-isolation/persistdata/event/hw_status.ring";
+
+/**
+ * @class EventStore
+ *
+ * @brief Bounded memory-mapped ring buffer store of the hardware
+ *        isolation events.
+ *
+ * @details * All the events are stored in the fixed size slots of the single
+ *            file which is mapped into the memory.
+ *          * The event is always written into the next free slot from
+ *            the ring head and the replaced slot is freed after the new
+ *            slot is synced so, the power loss while writing cannot lose
+ *            the persisted event. The latest slot sequence wins if both
+ *            are found while loading.
+ *          * The ring head is derived from the latest slot while loading
+ *            instead of persisting in the header so, the header is written
+ *            only while initializing and clearing.
+ *          * Each slot has the generation of the header when it was written
+ *            and the checksum so, clearing all the events is just
+ *            incrementing the header generation.
+ *          * The partially written slot (for example, power loss while
+ *            writing) is dropped while loading since the checksum won't
+ *            match.
+ *          * The updated slots are made durable by the group commit.
+ */
+class EventStore
+{
+  public:
+    EventStore() = delete;
+    EventStore(const EventStore&) = delete;
+    EventStore& operator=(const EventStore&) = delete;
+    EventStore(EventStore&&) = delete;
+    EventStore& operator=(EventStore&&) = delete;
+    ~EventStore();
+
+    /**
+     * @brief Constructor to map and load the store from the given path.
+     *
+     * @param[in] path - the store file path
+     * @param[in] groupCommit - the group commit to sync the updated slots
+     */
+    EventStore(const std::string& path, persist::GroupCommit& groupCommit);
+
+    /**
+     * @brief Used to get the persisted events id
+     *
+     * @return the list of persisted events id
+     */
+    std::vector<EventId> getEventIds() const;
+
+    /**
+     * @brief Used to get the persisted payload of the given event
+     *
+     * @param[in] eventId - the event id
+     *
+     * @return the EventPayload on success
+     *         Empty optional if not persisted
+     */
+    std::optional<EventPayload> get(const EventId eventId) const;
+
+    /**
+     * @brief Used to add or update the payload of the given event
+     *
+     * @param[in] eventId - the event id
+     * @param[in] payload - the serialized event members
+     *
+     * @return true on success false otherwise.
+     */
+    bool put(const EventId eventId, const EventPayload& payload);
+
+    /**
+     * @brief Used to remove the given event
+     *
+     * @param[in] eventId - the event id
+     *
+     * @return NULL
+     */
+    void remove(const EventId eventId);
+
+    /**
+     * @brief Used to remove all the events
+     *
+     * @return NULL
+     *
+     * @note It just updates the header generation.
+     */
+    void clear();
+
+  private:
+    /**
+     * @brief The store header which is stored at the beginning of the file
+     */
+    struct Header
+    {
+        std::array<uint8_t, 4> magic;
+        uint32_t version;
+        uint32_t slotCount;
+        uint32_t slotSize;
+        uint64_t generation;
+        uint32_t checksum;
+    };
+
+    /**
+     * @brief The slot header which is stored at the beginning of each slot
+     *        and followed by the payload.
+     */
+    struct SlotHeader
+    {
+        uint64_t generation;
+        uint64_t sequence;
+        EventId eventId;
+        uint32_t payloadSize;
+        uint32_t checksum;
+        uint32_t reserved;
+    };
+
+    /** @brief The store file path */
+    std::string _path;
+
+    /** @brief The group commit to sync the updated slots */
+    persist::GroupCommit& _groupCommit;
+
+    /** @brief The mapped store file */
+    uint8_t* _mappedStore{nullptr};
+
+    /** @brief The mapped store size */
+    std::size_t _mappedSize{0};
+
+    /** @brief The slot index of the persisted events */
+    std::map<EventId, uint32_t> _eventSlots;
+
+    /** @brief The replaced slots to free once the new slots are synced */
+    std::vector<uint32_t> _replacedSlots;
+
+    /** @brief The next slot index to look up the free slot */
+    uint32_t _head{0};
+
+    /** @brief The sequence of the latest written slot */
+    uint64_t _sequence{0};
+
+    /**
+     * @brief Used to map the store file and load the persisted events.
+     *
+     * @return true on success false otherwise.
+     */
+    bool open();
+
+    /**
+     * @brief Used to load the valid slots of the current generation
+     *
+     * @return NULL
+     */
+    void load();
+
+    /**
+     * @brief Used to get the latest generation of the slots which are
+     *        having the valid checksum.
+     *
+     * @return the latest slot generation, "1" if no slot is valid
+     */
+    uint64_t getLatestSlotGeneration() const;
+
+    /**
+     * @brief Used to request the group commit to sync the mapped store
+     *
+     * @return NULL
+     */
+    void requestSync();
+
+    /**
+     * @brief Used to initialize the header to drop all the slots
+     *
+     * @param[in] generation - the generation to use
+     *
+     * @return NULL
+     */
+    void initHeader(const uint64_t generation);
+
+    Header& header() const;
+
+    SlotHeader& slotHeader(const uint32_t slot) const;
+
+    uint8_t* slotPayload(const uint32_t slot) const;
+
+    uint32_t getHeaderChecksum() const;
+
+    uint32_t getSlotChecksum(const uint32_t slot) const;
+
+    /**
+     * @brief Used to check whether the given slot is having the valid event
+     *
+     * @param[in] slot - the slot index
+     *
+     * @return true if valid false otherwise.
+     */
+    bool isValidSlot(const uint32_t slot) const;
+};
+
+} // namespace event
+} // namespace hw_isolation
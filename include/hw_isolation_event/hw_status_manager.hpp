@@ -4,11 +4,16 @@
 
 #include "common/isolatable_hardwares.hpp"
 #include "hw_isolation_event/event.hpp"
+#include "hw_isolation_event/event_store.hpp"
 #include "hw_isolation_record/entry.hpp"
 #include "hw_isolation_record/manager.hpp"
 
 #include <sdbusplus/bus.hpp>
 
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 namespace hw_isolation
 {
 namespace event
@@ -18,6 +23,36 @@ namespace hw_status
 
 using HwStatusEvents = std::map<EventId, std::unique_ptr<Event>>;
 
+/**
+ * @brief The details of the hardware status event which is required
+ *        for the hardware.
+ */
+struct RequiredEvent
+{
+    EventSeverity severity;
+    EventMsg msg;
+    std::string bmcErrorLogPath;
+};
+
+/**
+ * @brief The required hardware status events by the hardware inventory path.
+ */
+using RequiredEvents = std::map<std::string, RequiredEvent>;
+
+/**
+ * @brief The hardware status event target and its hardwares which are
+ *        evaluated together to get the event.
+ *
+ * @note The dimms under the ocmb are evaluated together since those are
+ *       modelled as the same inventory, otherwise the target itself is
+ *       the only hardware.
+ */
+struct StatusEventTarget
+{
+    struct pdbg_target* target;
+    std::vector<struct pdbg_target*> hws;
+};
+
 /**
  *  @class Manager
  *
@@ -66,11 +101,28 @@ class Manager
      */
     EventId _lastEventId;
 
+    /**
+     * @brief The store to persist the hardware status events
+     *
+     * @note Must be declared before "_hwStatusEvents" since the events
+     *        are using this while destructing.
+     */
+    EventStore _eventStore;
+
     /**
      * @brief Hardware status event list
      */
     HwStatusEvents _hwStatusEvents;
 
+    /**
+     * @brief The hardware status event ids by the hardware inventory path
+     *
+     * @note Must be updated along with "_hwStatusEvents" to avoid looking
+     *       into the associations of all the events to find the events
+     *       of the given hardware.
+     */
+    std::unordered_map<std::string, std::set<EventId>> _hwStatusEventIds;
+
     /**
      * @brief Used to get isolatable hardware details
      */
@@ -87,6 +139,16 @@ class Manager
      */
     std::vector<std::string> _requiredHwsPdbgClass;
 
+    /**
+     * @brief The inventory path of the hardwares which are resolved
+     *        together while restoring the hardware status event.
+     *
+     * @note It is valid only while restoring the hardware status event.
+     */
+    std::unordered_map<devtree::EntityPathKey,
+                       std::optional<sdbusplus::message::object_path>>
+        _resolvedInventoryPaths;
+
     /**
      * @brief The list of D-Bus match objects to process
      *        the interested D-Bus signal if catched.
@@ -102,12 +164,21 @@ class Manager
         _watcherOnOperationalStatus;
 
     /**
-     * @brief Used to handle the deallocated hardware at the host runtime.
+     * @brief The deallocated hardwares inventory path at the host runtime
+     *        which are pending to handle.
      */
-    std::queue<
-        std::pair<std::string, std::unique_ptr<sdeventplus::utility::Timer<
-                                   sdeventplus::ClockId::Monotonic>>>>
-        _deallocatedHwHandler;
+    std::set<std::string> _deallocatedHws;
+
+    /**
+     * @brief Used to handle the pending deallocated hardwares together
+     *        at the host runtime.
+     *
+     * @note The timer is restarted for each deallocated hardware to handle
+     *       all the hardwares which are deallocated at the same time
+     *       in the single batch.
+     */
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic>
+        _deallocatedHwsTimer;
 
     /**
      * @brief Create the hardware status event dbus object
@@ -125,11 +196,63 @@ class Manager
         const std::string& hwInventoryPath, const std::string& bmcErrorLogPath);
 
     /**
-     * @brief Used to clear the old hardwares status event
+     * @brief Used to add the given hardware status event into the event list
+     *        and the event ids by the hardware inventory path.
+     *
+     * @param[in] eventId - the hardware status event id.
+     * @param[in] event - the hardware status event to add.
      *
      * @return NULL
      */
-    void clearHardwaresStatusEvent();
+    void addHwStatusEvent(const EventId eventId, std::unique_ptr<Event> event);
+
+    /**
+     * @brief Used to remove the given hardware status event from the event
+     *        list and the event ids by the hardware inventory path.
+     *
+     * @param[in] eventIt - the iterator of the hardware status event to remove.
+     *
+     * @return the iterator following the removed hardware status event.
+     */
+    HwStatusEvents::iterator
+        removeHwStatusEvent(HwStatusEvents::iterator eventIt);
+
+    /**
+     * @brief Used to get the hardware inventory path from the given
+     *        hardware status event associations.
+     *
+     * @param[in] event - the hardware status event.
+     *
+     * @return the hardware inventory path on success
+     *         Empty string if the event is not associated with any hardware.
+     */
+    std::string getEventHwInventoryPath(const Event& event);
+
+    /**
+     * @brief Used to get the association to add in the hardware status event
+     *
+     * @param[in] hwInventoryPath - the hardware inventory path.
+     * @param[in] bmcErrorLogPath - the bmc error log object path.
+     *
+     * @return the association definition of the hardware status event
+     */
+    type::AssociationDef
+        getEventAssociations(const std::string& hwInventoryPath,
+                             const std::string& bmcErrorLogPath);
+
+    /**
+     * @brief Used to reconcile the existing hardwares status event with
+     *        the required hardwares status event.
+     *
+     * @param[in] requiredEvents - the required hardwares status event.
+     *
+     * @return NULL
+     *
+     * @note The existing event will be kept with the same id if it is
+     *       still required and updated only if the details are changed
+     *       to avoid the unnecessary D-Bus signals.
+     */
+    void reconcileHardwaresStatusEvent(const RequiredEvents& requiredEvents);
 
     /**
      * @brief Used to get the isolated hardware record status
@@ -172,11 +295,15 @@ class Manager
     void clearHwStatusEventIfexists(const std::string& hwInventoryPath);
 
     /**
-     * @brief Used to handle the deallocated hardware at the host runtime.
+     * @brief Used to handle the pending deallocated hardwares at the host
+     *        runtime.
      *
      * @return NULL
+     *
+     * @note The isolated hardware records are looked up only once for all
+     *       the pending hardwares.
      */
-    void handleDeallocatedHw();
+    void handleDeallocatedHws();
 
     /**
      * @brief Used to create event on the object if that object is not
@@ -218,6 +345,32 @@ class Manager
      */
     void restoreHardwaresStatusEvent(bool osRunning = false);
 
+    /**
+     * @brief Used to get the targets which are used to create
+     *        the hardware status event.
+     *
+     * @return The list of targets along with its hardwares
+     *
+     * @note The ECO cores (fc) are skipped since those are not modelled
+     *       in the inventory.
+     */
+    std::vector<StatusEventTarget> getStatusEventTargets();
+
+    /**
+     * @brief Used to resolve the inventory path of the present hardwares
+     *        which are used to create the hardware status event together
+     *        to avoid resolving the same parent FRU for each hardware.
+     *
+     * @param[in] targets - The targets to create the hardware status event
+     *
+     * @return NULL
+     *
+     * @note The resolved inventory paths are kept in
+     *       "_resolvedInventoryPaths".
+     */
+    void resolveHardwaresInventoryPath(
+        const std::vector<StatusEventTarget>& targets);
+
     /**
      * @brief Used to populate the details needed to
      *        create hardware status event for all hardware.
@@ -264,11 +417,19 @@ class Manager
 
     /**
      * @brief Helper API to restore hardware isolation status event from
-     *        the persisted files.
+     *        the event store.
      *
      * @return NULL
      */
     void restorePersistedHwIsolationStatusEvent();
+
+    /**
+     * @brief Helper API to migrate the event persisted files (which were
+     *        used before the event store) into the event store.
+     *
+     * @return NULL
+     */
+    void migratePersistedEventFiles();
 };
 
 } // namespace hw_status
@@ -4,6 +4,7 @@
 
 #include "common/common_types.hpp"
 #include "common/phal_devtree_utils.hpp"
+#include "hw_isolation_record/entry_journal.hpp"
 #include "hw_isolation_record/openpower_guard_interface.hpp"
 
 #include <cereal/access.hpp>
@@ -24,6 +25,11 @@ namespace record
 
 class Manager;
 
+/**
+ * @brief The entry persisted path which was used before the entry journal.
+ *
+ * @note It is used only to migrate the persisted entries into the journal.
+ */
 constexpr auto HW_ISOLATION_ENTRY_PERSIST_PATH =
     "/var/lib/op-hw-isolation/persistdata/record_entry/{}";
 
@@ -115,6 +121,11 @@ class Entry :
      */
     openpower_guard::EntityPath getEntityPath() const;
 
+    /**
+     * @brief Used get the entity path key of isolated hardware.
+     */
+    const devtree::EntityPathKey& getEntityPathKey() const;
+
     /**
      * @brief Used get the record id of isolated hardware.
      */
@@ -122,18 +133,44 @@ class Entry :
 
     /**
      * @brief Serialize and persisted the required members
+     *        into the entry journal.
      *
      * @return NULL
+     *
+     * @note The members will be persisted only if the entry is dirty.
      */
     void serialize();
 
     /**
-     * @brief Deserialize the persisted members.
+     * @brief Deserialize the persisted members from the entry journal.
      *
      * @return true if deserialized false otherwise.
+     *
+     * @note The entry persisted file (which was used before the entry journal)
+     *       will be migrated into the entry journal if the entry is not
+     *       found in the entry journal.
      */
     bool deserialize();
 
+    using EpochTime::elapsed;
+
+    /**
+     * @brief Overridden to mark the entry as dirty if the elapsed
+     *        is changed.
+     *
+     * @note Only the entity path and the elapsed are persisted in the entry
+     *       journal (the entity path is not changed after the entry is
+     *       created) so, the other properties are not marking the entry
+     *       as dirty.
+     */
+    uint64_t elapsed(uint64_t value, bool skipSignal) override;
+
+    /**
+     * @brief Used to get the number of skipped entry writes since the entry
+     *        was not changed.
+     */
+    static std::size_t getSkippedWritesCount();
+
   private:
     /** @brief Attached bus connection */
     sdbusplus::bus::bus& _bus;
@@ -150,35 +187,28 @@ class Entry :
     /** @brief The entity path of this entry */
     openpower_guard::EntityPath _entityPath;
 
-    /**
-     * @brief Allow cereal class access to allow save and load functions
-     *        to be private
-     */
-    friend class cereal::access;
+    /** @brief The entity path key of this entry to use in the lookup */
+    devtree::EntityPathKey _entityPathKey;
+
+    /** @brief Used to indicate the entry is changed since it is persisted */
+    bool _dirty{true};
+
+    /** @brief The number of skipped entry writes of all the entries */
+    static std::size_t skippedWritesCount;
 
     /**
-     * @brief Helper template that is required by Cereal to perform
-     *        serialization.
-     *
-     * @details It will only serialize the required members that are not
-     *          persisted in the hardware isolation partition file that
-     *          shared between the BMC and Host applications.
-     *
-     * @tparam Archive    - Cereal archive type (BinaryOutputArchive).
-     * @param[in] archive - Reference to Cereal archive.
-     * @param[in] version - Class version that enables handling
-     *                      a serialized data.
+     * @brief Used to migrate the entry persisted file (which was used before
+     *        the entry journal) into the entry journal.
      *
-     * @return NULL
+     * @return true if migrated false otherwise.
      */
-    template <class Archive>
-    void save(Archive& archive, const uint32_t /*version*/) const
-    {
-        auto entityPathRawData =
-            hw_isolation::devtree::convertEntityPathIntoRawData(_entityPath);
+    bool migratePersistedFile();
 
-        archive(entityPathRawData, elapsed());
-    }
+    /**
+     * @brief Allow cereal class access to allow save and load functions
+     *        to be private
+     */
+    friend class cereal::access;
 
     /**
      * @brief Helper template that is required by Cereal to perform
@@ -188,6 +218,9 @@ class Entry :
      *          persisted in the hardware isolation partition file that
      *          shared between the BMC and Host applications.
      *
+     * @note It is used only to migrate the entry persisted file
+     *       into the entry journal.
+     *
      * @tparam Archive    - Cereal archive type (BinaryInputArchive).
      * @param[in] archive - Reference to Cereal archive.
      * @param[in] version - Class version that enables handling
@@ -204,9 +237,9 @@ class Entry :
         // Must be ordered based on the serialization to deserialize.
         archive(persistedEntityPathRawData, persistedElapsed);
 
-        if (openpower_guard::EntityPath(persistedEntityPathRawData.data(),
-                                        persistedEntityPathRawData.size()) ==
-            _entityPath)
+        if (devtree::EntityPathKey(persistedEntityPathRawData.data(),
+                                   persistedEntityPathRawData.size()) ==
+            _entityPathKey)
         {
             // Skip to send property change signal in the restore path.
             elapsed(persistedElapsed, true);
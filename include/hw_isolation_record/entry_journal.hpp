@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/entity_path_key.hpp"
+#include "common/persist_utils.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace hw_isolation
+{
+namespace record
+{
+
+constexpr auto HW_ISOLATION_ENTRY_JOURNAL_PATH =
+    "/var/lib/op-hw-isolation/persistdata/record_entry.journal";
+
+namespace entry
+{
+
+using EntryRecordId = uint32_t;
+
+/**
+ * @class EntryJournal
+ *
+ * @brief Append-only store of the hardware isolation entries members
+ *        which are not persisted in the hardware isolation partition file.
+ *
+ * @details * All the entries are stored in the single journal file instead
+ *            of the file per entry.
+ *          * Every update is appended as the fixed size record and
+ *            the latest record of the entry wins while loading.
+ *          * The journal is compacted (rewritten with the live entries) once
+ *            the stale records are grown more than the live entries.
+ *          * Each record has the checksum so, the partially written record
+ *            (for example, power loss while writing) and the following
+ *            records are dropped while loading.
+ *          * The appended records are made durable by the group commit.
+ *          * The failed append is removed from the journal and the journal
+ *            is rewritten with the live entries so that the journal is
+ *            not diverged from the live entries.
+ */
+class EntryJournal
+{
+  public:
+    /**
+     * @brief The persisted members of the entry
+     */
+    struct Record
+    {
+        devtree::EntityPathKey entityPath;
+        uint64_t elapsed;
+    };
+
+    EntryJournal() = delete;
+    EntryJournal(const EntryJournal&) = delete;
+    EntryJournal& operator=(const EntryJournal&) = delete;
+    EntryJournal(EntryJournal&&) = delete;
+    EntryJournal& operator=(EntryJournal&&) = delete;
+    ~EntryJournal();
+
+    /**
+     * @brief Constructor to load the journal from the given path.
+     *
+     * @param[in] path - the journal file path
+     * @param[in] groupCommit - the group commit to sync the appended records
+     */
+    EntryJournal(const std::string& path, persist::GroupCommit& groupCommit);
+
+    /**
+     * @brief Used to get the persisted record of the given entry
+     *
+     * @param[in] entryRecordId - the entry record id
+     *
+     * @return the Record on success
+     *         Empty optional if not persisted
+     */
+    std::optional<Record> get(const EntryRecordId entryRecordId) const;
+
+    /**
+     * @brief Used to add or update the record of the given entry
+     *
+     * @param[in] entryRecordId - the entry record id
+     * @param[in] record - the entry members to persist
+     *
+     * @return NULL
+     */
+    void put(const EntryRecordId entryRecordId, const Record& record);
+
+    /**
+     * @brief Used to remove the record of the given entry
+     *
+     * @param[in] entryRecordId - the entry record id
+     *
+     * @return NULL
+     */
+    void remove(const EntryRecordId entryRecordId);
+
+    /**
+     * @brief Used to remove the records which are not satisfied
+     *        the given predicate.
+     *
+     * @param[in] isLive - predicate to check whether the given entry
+     *                     record id is live or not
+     *
+     * @return NULL
+     */
+    template <typename Predicate>
+    void retainIf(Predicate isLive)
+    {
+        for (auto it = _records.begin(); it != _records.end();)
+        {
+            auto nextIt = std::next(it, 1);
+            if (!isLive(it->first))
+            {
+                remove(it->first);
+            }
+            it = nextIt;
+        }
+    }
+
+  private:
+    /**
+     * @brief The journal record operation type
+     */
+    enum class Operation : uint8_t
+    {
+        Put = 1,
+        Remove = 2
+    };
+
+    /** @brief The journal file path */
+    std::string _path;
+
+    /** @brief The group commit to sync the appended records */
+    persist::GroupCommit& _groupCommit;
+
+    /** @brief The journal file descriptor to append */
+    int _fd{-1};
+
+    /** @brief The live records */
+    std::map<EntryRecordId, Record> _records;
+
+    /** @brief The number of records in the journal file */
+    std::size_t _journalRecordsCount{0};
+
+    /** @brief The journal file is not same as the live records since
+     *         the append or compact was failed, the journal file will be
+     *         rewritten with the live records in the next append.
+     */
+    bool _needsCompact{false};
+
+    /**
+     * @brief Used to load the journal file into the live records
+     *
+     * @return NULL
+     */
+    void load();
+
+    /**
+     * @brief Used to open the journal file to append
+     *
+     * @return true on success false otherwise.
+     */
+    bool open();
+
+    /**
+     * @brief Used to append the given operation into the journal file
+     *
+     * @param[in] operation - the journal operation
+     * @param[in] entryRecordId - the entry record id
+     * @param[in] record - the entry members
+     *
+     * @return NULL
+     */
+    void append(const Operation operation, const EntryRecordId entryRecordId,
+                const Record& record);
+
+    /**
+     * @brief Used to rewrite the journal file with the live records
+     *
+     * @return NULL
+     */
+    void compact();
+};
+
+} // namespace entry
+} // namespace record
+} // namespace hw_isolation
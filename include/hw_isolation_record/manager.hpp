@@ -3,18 +3,29 @@
 #pragma once
 
 #include "common/common_types.hpp"
+#include "common/entity_path_key.hpp"
 #include "common/isolatable_hardwares.hpp"
+#include "common/persist_utils.hpp"
 #include "common/watch.hpp"
 #include "hw_isolation_record/entry.hpp"
 #include "hw_isolation_record/openpower_guard_interface.hpp"
+#include "hw_isolation_record/restore_snapshot.hpp"
 #include "xyz/openbmc_project/Collection/DeleteAll/server.hpp"
 #include "xyz/openbmc_project/HardwareIsolation/Create/server.hpp"
 
 #include <cereal/types/set.hpp>
 #include <sdeventplus/event.hpp>
+#include <sdeventplus/source/event.hpp>
 #include <sdeventplus/utility/timer.hpp>
+#include <xyz/openbmc_project/State/ServiceReady/server.hpp>
 
+#include <algorithm>
+#include <deque>
 #include <queue>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace hw_isolation
 {
@@ -30,7 +41,13 @@ using IsolatedHardwares =
 using DeleteAllInterface =
     sdbusplus::xyz::openbmc_project::Collection::server::DeleteAll;
 
-using EcoCores = std::set<devtree::DevTreePhysPath>;
+using ServiceReadyInterface =
+    sdbusplus::xyz::openbmc_project::State::server::ServiceReady;
+
+using EcoCores = std::unordered_set<devtree::EntityPathKey>;
+
+using EntryIndex =
+    std::unordered_multimap<devtree::EntityPathKey, entry::EntryRecordId>;
 
 /**
  *  @class Manager
@@ -40,9 +57,12 @@ using EcoCores = std::set<devtree::DevTreePhysPath>;
  *  @details Implemetation for below interfaces
  *           xyz.openbmc_project.HardwareIsolation.Create
  *           xyz.openbmc_project.Collection.DeleteAll
+ *           xyz.openbmc_project.State.ServiceReady
  *           org.open_power.HardwareIsolation.Create
  */
-class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
+class Manager :
+    public type::ServerObject<CreateInterface, DeleteAllInterface,
+                              ServiceReadyInterface>
 {
   public:
     Manager() = delete;
@@ -50,7 +70,13 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
     Manager& operator=(const Manager&) = delete;
     Manager(Manager&&) = delete;
     Manager& operator=(Manager&&) = delete;
-    virtual ~Manager() = default;
+
+    /**
+     * @brief Destructor to commit the pending persisted data while
+     *        the members which are used by the scheduled writers
+     *        are alive.
+     */
+    virtual ~Manager();
 
     /** @brief Constructor to put object onto bus at a dbus path.
      *
@@ -114,6 +140,16 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
      * @brief Create dbus objects for isolated hardwares
      *        from their persisted location.
      *
+     * @details * The isolated hardwares are restored from the restore
+     *            snapshot if the records and device tree are not changed
+     *            since the snapshot is taken else the records are resolved.
+     *          * The unchanged records are restored from the snapshot
+     *            if only the records are changed.
+     *          * The remaining records are resolved from the event loop in
+     *            chunks if the progressive startup is enabled.
+     *          * The ServiceReady state will be enabled once all the records
+     *            are restored.
+     *
      * return NULL on success.
      *        Throw exception on failure.
      */
@@ -142,9 +178,36 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
         getIsolatedHwRecordInfo(
             const sdbusplus::message::object_path& hwInventoryPath);
 
+    /**
+     * @brief Used to get the isolated hardware entry information of
+     *        the given hardwares together.
+     *
+     * @param[in] hwInventoryPaths - the hardwares inventory path to get
+     *                               the entry information.
+     *
+     * @return the map of the hardware inventory path and the tuple with
+     *         EntrySeverity, EntryErrLogPath for the isolated hardwares.
+     *
+     * @note The entries are looked up only once for all the given hardwares
+     *       and the hardware which is not isolated won't be in the map.
+     */
+    std::map<std::string,
+             std::tuple<entry::EntrySeverity, entry::EntryErrLogPath>>
+        getIsolatedHwsRecordInfo(const std::set<std::string>& hwInventoryPaths);
+
     int getHigherPrecendenceEntry(
         std::vector<entry::EntrySeverity>& eventSeverityList);
 
+    /**
+     * @brief Used to get the journal to persist the entries members.
+     */
+    entry::EntryJournal& getEntryJournal();
+
+    /**
+     * @brief Used to get the group commit to persist the objects data.
+     */
+    persist::GroupCommit& getGroupCommit();
+
   private:
     /**
      *  * @brief Attached bus connection
@@ -156,11 +219,34 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
      */
     const sdeventplus::Event& _eventLoop;
 
+    /**
+     * @brief Used to persist the objects data in batches
+     *
+     * @note Must be declared before the members which are persisting
+     *       by using this.
+     */
+    persist::GroupCommit _groupCommit;
+
+    /**
+     * @brief The persisted members of the isolated hardwares entry
+     *
+     * @note Must be declared before "_isolatedHardwares" since the entries
+     *        are using this while destructing.
+     */
+    entry::EntryJournal _entryJournal;
+
     /**
      * @brief Isolated hardwares list
      */
     IsolatedHardwares _isolatedHardwares;
 
+    /**
+     * @brief Isolated hardwares record id by their entity path key
+     *
+     * @note Must be updated along with _isolatedHardwares.
+     */
+    EntryIndex _entryIndex;
+
     /**
      * @brief Used to get isolatable hardware details
      */
@@ -188,6 +274,43 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
      */
     EcoCores _persistedEcoCores;
 
+    /**
+     * @brief The records which are read in the restore path
+     *
+     * @note It is kept until the restore is finished to take the snapshot.
+     */
+    openpower_guard::GuardRecords _restoreRecords;
+
+    /**
+     * @brief The snapshot key which is taken in the restore path
+     */
+    std::optional<snapshot::SnapshotKey> _restoreSnapshotKey;
+
+    /**
+     * @brief The records which are not restored yet
+     */
+    std::deque<openpower_guard::GuardRecord> _pendingRestoreRecords;
+
+    /**
+     * @brief The event source to restore the pending records from
+     *        the event loop
+     */
+    std::unique_ptr<sdeventplus::source::Defer> _restoreSource;
+
+    /**
+     * @brief The private bus connections of the restore workers
+     *
+     * @note It is created once and reused for all the chunks
+     *       until the restore is finished.
+     */
+    std::vector<sdbusplus::bus::bus> _restoreWorkerBuses;
+
+    /**
+     * @brief Used to indicate the "_persistedEcoCores" is updated
+     *        and needs to be flushed into the persisted location.
+     */
+    bool _ecoCoresDirty{false};
+
     /**
      * @brief Allow cereal class access to allow save and load functions
      *        to be private
@@ -196,15 +319,16 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
 
     /**
      * @brief Helper template that is required by Cereal to perform
-     *        serialization and deserialization.
+     *        serialization.
      *
      * @details * TODO: It is a workaround until fix the following issue
      *            ibm-openbmc/dev/issues/3573.
-     *          * It will only serialize and deserialize
-     *            the "_persistedEcoCores" member that is not persisted
-     *            in the disruptive code update.
+     *          * It will only serialize the "_persistedEcoCores" member
+     *            that is not persisted in the disruptive code update.
+     *          * The ECO cores are persisted as DevTreePhysPath set
+     *            to keep the persisted data format as is.
      *
-     * @tparam Archive    - Cereal archive type.
+     * @tparam Archive    - Cereal archive type (BinaryOutputArchive).
      * @param[in] archive - Reference to Cereal archive.
      * @param[in] version - Class version that enables handling
      *                      a serialized data.
@@ -212,15 +336,51 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
      * @return NULL
      */
     template <class Archive>
-    void serialize(Archive& archive, const uint32_t /*version*/)
+    void save(Archive& archive, const uint32_t /*version*/) const
+    {
+        std::set<devtree::DevTreePhysPath> ecoCores;
+        std::ranges::for_each(_persistedEcoCores,
+                              [&ecoCores](const auto& ecoCore) {
+            ecoCores.emplace(ecoCore.toRawData());
+        });
+        archive(ecoCores);
+    }
+
+    /**
+     * @brief Helper template that is required by Cereal to perform
+     *        deserialization.
+     *
+     * @details * TODO: It is a workaround until fix the following issue
+     *            ibm-openbmc/dev/issues/3573.
+     *          * It will only deserialize the "_persistedEcoCores" member
+     *            that is not persisted in the disruptive code update.
+     *
+     * @tparam Archive    - Cereal archive type (BinaryInputArchive).
+     * @param[in] archive - Reference to Cereal archive.
+     * @param[in] version - Class version that enables handling
+     *                      a deserialized data.
+     *
+     * @return NULL
+     */
+    template <class Archive>
+    void load(Archive& archive, const uint32_t /*version*/)
     {
-        archive(_persistedEcoCores);
+        std::set<devtree::DevTreePhysPath> ecoCores;
+        archive(ecoCores);
+
+        _persistedEcoCores.clear();
+        std::ranges::for_each(ecoCores, [this](const auto& ecoCore) {
+            _persistedEcoCores.emplace(ecoCore.data(), ecoCore.size());
+        });
     }
 
     /**
      * @brief Used to serialize ECO core records.
      *
      * @return NULL
+     *
+     * @note The records are staged in the group commit to replace
+     *       the persisted file atomically.
      */
     void serialize();
 
@@ -374,17 +534,165 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
      * @param[in] coreDevTreePhysPath - The core device tree physical path.
      *
      * @return NULL
+     *
+     * @note The list is just marked as dirty, use flushEcoCores()
+     *       to persist.
      */
-    void
-        updateEcoCoresList(const bool ecoCore,
-                           const devtree::DevTreePhysPath& coreDevTreePhysPath);
+    void updateEcoCoresList(const bool ecoCore,
+                            const devtree::EntityPathKey& coreDevTreePhysPath);
+
+    /**
+     * @brief Helper API to remove the given entry from the entry index
+     *
+     * @param[in] entryRecordId - The entry record id to remove
+     * @param[in] entityPathKey - The entry entity path key
+     *
+     * @return NULL
+     */
+    void removeFromEntryIndex(const entry::EntryRecordId entryRecordId,
+                              const devtree::EntityPathKey& entityPathKey);
 
     /**
      * @brief Helper API to cleanup persisted eco cores
      *
      * @return NULL
+     *
+     * @note The list is just marked as dirty, use flushEcoCores()
+     *       to persist.
      */
     void cleanupPersistedEcoCores();
+
+    /**
+     * @brief Helper API to schedule the ECO cores list persist in
+     *        the group commit if it is dirty.
+     *
+     * @return NULL
+     */
+    void flushEcoCores();
+
+    /**
+     * @brief Helper API to restore the isolated hardware from the given
+     *        snapshot entry without resolving the record.
+     *
+     * @param[in] snapshotEntry - The snapshot entry to restore
+     *
+     * @return NULL
+     */
+    void restoreFromSnapshotEntry(const snapshot::SnapshotEntry& snapshotEntry);
+
+    /**
+     * @brief Helper API to schedule the restore snapshot persist in
+     *        the group commit by using the current entries.
+     *
+     * @param[in] snapshotKey - The snapshot key which is taken before
+     *                          reading the records
+     * @param[in] records - The records which are used to resolve
+     *                      the current entries
+     *
+     * @return NULL
+     *
+     * @note Nothing will be persisted if the snapshot key is not given.
+     */
+    void scheduleRestoreSnapshot(
+        const std::optional<snapshot::SnapshotKey>& snapshotKey,
+        const openpower_guard::GuardRecords& records);
+
+    /**
+     * @brief The hardware isolation record which is going through
+     *        the restore pipeline.
+     */
+    struct RestoreRecord
+    {
+        openpower_guard::GuardRecord record;
+        devtree::EntityPathKey entityPathKey;
+        bool ecoCore{false};
+        entry::EntrySeverity severity{entry::EntrySeverity::Critical};
+        isolatable_hws::IsolatableHWs::InventoryPathPlan plan;
+        bool resolved{false};
+        std::optional<sdbusplus::message::object_path> inventoryPath;
+        std::optional<sdbusplus::message::object_path> bmcErrorLog;
+    };
+
+    /**
+     * @brief Helper API to get the given record details to restore
+     *        by using the phal cec device tree.
+     *
+     * @param[in] record - The isolated hardware record to restore
+     *
+     * @return The restore record on success
+     *         Empty optional if the given record cannot be restored
+     *
+     * @note It is the first stage of the restore pipeline.
+     */
+    std::optional<RestoreRecord>
+        planRestoreRecord(const openpower_guard::GuardRecord& record);
+
+    /**
+     * @brief Helper API to resolve the inventory path and the error log
+     *        path of the given records by using the bmc D-Bus services.
+     *
+     * @param[in|out] restoreRecords - The records to resolve
+     *
+     * @return NULL
+     *
+     * @note * It is the second stage of the restore pipeline.
+     *       * The records are resolved concurrently in the worker threads
+     *         by using the private bus connection for each worker so,
+     *         the restore time won't be increased by the D-Bus latency of
+     *         each record.
+     *       * The records are grouped by the parent FRU and each group is
+     *         resolved by the single worker to look up the parent FRU only
+     *         once for the group.
+     */
+    void resolveRestoreRecords(std::vector<RestoreRecord>& restoreRecords);
+
+    /**
+     * @brief Helper API to create the dbus entry for the given resolved
+     *        record.
+     *
+     * @param[in] restoreRecord - The resolved record to create the entry
+     *
+     * @return NULL
+     *
+     * @note It is the last stage of the restore pipeline.
+     */
+    void createEntryForRestoreRecord(const RestoreRecord& restoreRecord);
+
+    /**
+     * @brief Helper API to restore the pending records
+     *
+     * @param[in] maxRecords - The maximum number of records to restore
+     *
+     * @return NULL
+     *
+     * @note The restore will be finished once all the pending records
+     *       are restored.
+     */
+    void restorePendingRecords(const std::size_t maxRecords);
+
+    /**
+     * @brief Helper API to revalidate the pending records against
+     *        the current hardware isolation records
+     *
+     * @param[in] records - The current hardware isolation records
+     *
+     * @return NULL
+     *
+     * @note The pending records which are deleted or resolved are dropped
+     *       and the remaining pending records are updated with the current
+     *       records.
+     */
+    void refreshPendingRestoreRecords(
+        const openpower_guard::GuardRecords& records);
+
+    /**
+     * @brief Helper API to finish the restore path
+     *
+     * @param[in] snapshotKey - The snapshot key to take the restore snapshot
+     *
+     * @return NULL
+     */
+    void finishRestore(const std::optional<snapshot::SnapshotKey>& snapshotKey);
 };
 
 } // namespace record
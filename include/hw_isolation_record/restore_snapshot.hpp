@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/phal_devtree_utils.hpp"
+#include "hw_isolation_record/entry.hpp"
+#include "hw_isolation_record/openpower_guard_interface.hpp"
+
+#include <cereal/cereal.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace record
+{
+namespace snapshot
+{
+
+constexpr auto HW_ISOLATION_RESTORE_SNAPSHOT_PATH =
+    "/var/lib/op-hw-isolation/persistdata/record_snapshot";
+
+/**
+ * @brief The snapshot key to identify whether the snapshot is taken
+ *        for the current hardware isolation records and device tree.
+ */
+struct SnapshotKey
+{
+    uint64_t guardFileHash{0};
+    uint64_t devTreeHash{0};
+
+    bool operator==(const SnapshotKey&) const = default;
+
+    template <class Archive>
+    void serialize(Archive& archive)
+    {
+        archive(guardFileHash, devTreeHash);
+    }
+};
+
+/**
+ * @brief The resolved state of the isolated hardware entry
+ */
+struct SnapshotEntry
+{
+    entry::EntryRecordId recordId{0};
+    uint32_t elogId{0};
+    entry::EntryResolved resolved{false};
+    entry::EntrySeverity severity{entry::EntrySeverity::Critical};
+    std::string isolatedHardware;
+    bool ecoCore{false};
+    devtree::DevTreePhysPath entityPath;
+
+    template <class Archive>
+    void serialize(Archive& archive)
+    {
+        archive(recordId, elogId, resolved, severity, isolatedHardware,
+                ecoCore, entityPath);
+    }
+};
+
+using SnapshotEntries = std::vector<SnapshotEntry>;
+
+/**
+ * @brief The persisted restore snapshot
+ */
+struct Snapshot
+{
+    SnapshotKey key;
+    SnapshotEntries entries;
+};
+
+/**
+ * @brief Used to get the snapshot key for the current hardware isolation
+ *        records and device tree.
+ *
+ * @return the SnapshotKey on success
+ *         Empty optional if failed to get the files hash
+ *
+ * @note The device tree hash is reused until the device tree file
+ *       is modified.
+ */
+std::optional<SnapshotKey> getSnapshotKey();
+
+/**
+ * @brief Used to load the snapshot from the given path
+ *
+ * @param[in] path - the snapshot file path
+ *
+ * @return the Snapshot on success
+ *         Empty optional if not persisted or failed to load
+ */
+std::optional<Snapshot> load(const std::string& path);
+
+/**
+ * @brief Used to check whether the given snapshot entry is taken for
+ *        the given record.
+ *
+ * @param[in] snapshotEntry - the snapshot entry
+ * @param[in] record - the hardware isolation record
+ *
+ * @return true if matched false otherwise.
+ *
+ * @note The inventory path is not checked so, it can be used only if
+ *       the device tree is not changed since the snapshot is taken.
+ */
+bool isMatched(const SnapshotEntry& snapshotEntry,
+               const openpower_guard::GuardRecord& record);
+
+/**
+ * @brief Used to encode the given snapshot entries to persist
+ *
+ * @param[in] snapshotKey - the snapshot key
+ * @param[in] snapshotEntries - the snapshot entries
+ *
+ * @return the encoded snapshot on success
+ *         Empty optional on failure
+ */
+std::optional<std::string> encode(const SnapshotKey& snapshotKey,
+                                  const SnapshotEntries& snapshotEntries);
+
+} // namespace snapshot
+} // namespace record
+} // namespace hw_isolation
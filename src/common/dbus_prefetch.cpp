@@ -0,0 +1,312 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/dbus_prefetch.hpp"
+
+#include "common/common_types.hpp"
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <algorithm>
+#include <format>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+namespace hw_isolation
+{
+namespace prefetch
+{
+
+using namespace phosphor::logging;
+
+namespace
+{
+
+constexpr auto InventoryObjPath = "/xyz/openbmc_project/inventory";
+constexpr auto InventoryMgrName = "xyz.openbmc_project.Inventory.Manager";
+constexpr auto VPDLocationIface = "com.ibm.ipzvpd.Location";
+
+using ServicesIfaces = std::map<std::string, std::vector<std::string>>;
+using SubTree = std::map<std::string, ServicesIfaces>;
+
+using PropertyMap = std::map<std::string, PropertyValue>;
+using InterfaceMap = std::map<std::string, PropertyMap>;
+using ManagedObjects =
+    std::map<sdbusplus::message::object_path, InterfaceMap>;
+
+/**
+ * @brief The prefetched D-Bus data
+ */
+struct PrefetchedData
+{
+    bool inventorySubTreeFetched{false};
+    SubTree inventorySubTree;
+
+    bool inventoryObjectsFetched{false};
+    std::unordered_map<std::string, InterfaceMap> inventoryObjects;
+
+    std::unordered_map<std::string,
+                       std::vector<sdbusplus::message::object_path>>
+        frusByLocCode;
+};
+
+PrefetchedData prefetchedData;
+
+/**
+ * @brief The number of active restore scopes in the calling thread
+ */
+thread_local std::size_t restoreScopes{0};
+
+void prefetchInventorySubTree(sdbusplus::bus::bus& bus)
+{
+    try
+    {
+        auto method = bus.new_method_call(type::ObjectMapperName,
+                                          type::ObjectMapperPath,
+                                          type::ObjectMapperName, "GetSubTree");
+
+        // Passing the empty interfaces list to get all the interfaces
+        method.append(InventoryObjPath, 0, std::vector<std::string>());
+
+        auto reply = bus.call(method);
+        reply.read(prefetchedData.inventorySubTree);
+        prefetchedData.inventorySubTreeFetched = true;
+    }
+    catch (const sdbusplus::exception::SdBusError& e)
+    {
+        log<level::ERR>(std::format("Exception [{}] to prefetch the inventory "
+                                    "subtree",
+                                    e.what())
+                            .c_str());
+    }
+}
+
+void prefetchInventoryObjects(sdbusplus::bus::bus& bus)
+{
+    try
+    {
+        auto method = bus.new_method_call(InventoryMgrName, InventoryObjPath,
+                                          "org.freedesktop.DBus.ObjectManager",
+                                          "GetManagedObjects");
+
+        auto reply = bus.call(method);
+
+        ManagedObjects managedObjects;
+        reply.read(managedObjects);
+
+        for (auto& [objPath, ifaces] : managedObjects)
+        {
+            prefetchedData.inventoryObjects.emplace(objPath.str,
+                                                    std::move(ifaces));
+        }
+        prefetchedData.inventoryObjectsFetched = true;
+    }
+    catch (const sdbusplus::exception::SdBusError& e)
+    {
+        log<level::ERR>(std::format("Exception [{}] to prefetch the inventory "
+                                    "objects",
+                                    e.what())
+                            .c_str());
+    }
+}
+
+void prefetchFRUsByLocCode(sdbusplus::bus::bus& bus)
+{
+    // The VPD manager doesn't provide the bulk method so, getting the FRUs
+    // for all the unexpanded location codes which are found in the inventory.
+    std::set<std::string> unexpandedLocCodes;
+    for (const auto& [objPath, ifaces] : prefetchedData.inventoryObjects)
+    {
+        auto ifaceIt = ifaces.find(VPDLocationIface);
+        if (ifaceIt == ifaces.end())
+        {
+            continue;
+        }
+
+        auto propIt = ifaceIt->second.find("LocationCode");
+        if (propIt == ifaceIt->second.end())
+        {
+            continue;
+        }
+
+        if (auto locCode = std::get_if<std::string>(&propIt->second);
+            (locCode != nullptr) && !locCode->empty())
+        {
+            unexpandedLocCodes.emplace(*locCode);
+        }
+    }
+
+    for (const auto& locCode : unexpandedLocCodes)
+    {
+        try
+        {
+            auto method = bus.new_method_call(
+                "com.ibm.VPD.Manager", "/com/ibm/VPD/Manager",
+                "com.ibm.VPD.Manager", "GetFRUsByUnexpandedLocationCode");
+
+            // passing 0 as node number
+            // FIXME if enabled multi node system
+            method.append(locCode, static_cast<uint16_t>(0));
+
+            auto reply = bus.call(method);
+
+            std::vector<sdbusplus::message::object_path> frus;
+            reply.read(frus);
+            prefetchedData.frusByLocCode.emplace(locCode, std::move(frus));
+        }
+        catch (const sdbusplus::exception::SdBusError& e)
+        {
+            // The lookup will fallback to the D-Bus call for this location
+            // code so, just trace and continue with the next location code.
+            log<level::DEBUG>(std::format("Exception [{}] to prefetch the FRUs "
+                                          "for the location code [{}]",
+                                          e.what(), locCode)
+                                  .c_str());
+        }
+    }
+}
+
+} // namespace
+
+void prefetchRestoreData(sdbusplus::bus::bus& bus)
+{
+    prefetchInventorySubTree(bus);
+    prefetchInventoryObjects(bus);
+    prefetchFRUsByLocCode(bus);
+
+    log<level::INFO>(std::format("Prefetched [{}] inventory objects and [{}] "
+                                 "location codes",
+                                 prefetchedData.inventorySubTree.size(),
+                                 prefetchedData.frusByLocCode.size())
+                         .c_str());
+}
+
+RestoreScope::RestoreScope()
+{
+    restoreScopes++;
+}
+
+RestoreScope::~RestoreScope()
+{
+    restoreScopes--;
+}
+
+void release()
+{
+    prefetchedData = PrefetchedData();
+}
+
+std::optional<std::string> getServiceName(const std::string& objPath,
+                                          const std::string& interface)
+{
+    if ((restoreScopes == 0) || !prefetchedData.inventorySubTreeFetched)
+    {
+        return std::nullopt;
+    }
+
+    auto objIt = prefetchedData.inventorySubTree.find(objPath);
+    if (objIt == prefetchedData.inventorySubTree.end())
+    {
+        return std::nullopt;
+    }
+
+    std::optional<std::string> serviceName;
+    for (const auto& [service, ifaces] : objIt->second)
+    {
+        if (std::ranges::find(ifaces, interface) == ifaces.end())
+        {
+            continue;
+        }
+
+        if (serviceName.has_value())
+        {
+            // Hosted by more than one service, the D-Bus call
+            // will take care.
+            return std::nullopt;
+        }
+        serviceName = service;
+    }
+    return serviceName;
+}
+
+const PropertyValue* getPropertyValue(const std::string& objPath,
+                                      const std::string& interface,
+                                      const std::string& propName)
+{
+    if ((restoreScopes == 0) || !prefetchedData.inventoryObjectsFetched)
+    {
+        return nullptr;
+    }
+
+    auto objIt = prefetchedData.inventoryObjects.find(objPath);
+    if (objIt == prefetchedData.inventoryObjects.end())
+    {
+        return nullptr;
+    }
+
+    auto ifaceIt = objIt->second.find(interface);
+    if (ifaceIt == objIt->second.end())
+    {
+        return nullptr;
+    }
+
+    auto propIt = ifaceIt->second.find(propName);
+    if (propIt == ifaceIt->second.end())
+    {
+        return nullptr;
+    }
+    return &propIt->second;
+}
+
+std::optional<std::vector<sdbusplus::message::object_path>>
+    getSubTreePaths(const std::string& parentObjPath,
+                    const std::string& interface)
+{
+    if ((restoreScopes == 0) || !prefetchedData.inventorySubTreeFetched ||
+        !(parentObjPath == InventoryObjPath ||
+          parentObjPath.starts_with(std::string(InventoryObjPath) + "/")))
+    {
+        return std::nullopt;
+    }
+
+    const std::string childPathPrefix{parentObjPath + "/"};
+
+    std::vector<sdbusplus::message::object_path> childPaths;
+    for (auto objIt =
+             prefetchedData.inventorySubTree.lower_bound(childPathPrefix);
+         objIt != prefetchedData.inventorySubTree.end() &&
+         objIt->first.starts_with(childPathPrefix);
+         ++objIt)
+    {
+        auto hasIface = std::ranges::any_of(objIt->second,
+                                            [&interface](const auto& service) {
+            return std::ranges::find(service.second, interface) !=
+                   service.second.end();
+        });
+
+        if (hasIface)
+        {
+            childPaths.emplace_back(objIt->first);
+        }
+    }
+    return childPaths;
+}
+
+std::optional<std::vector<sdbusplus::message::object_path>>
+    getFRUsByUnexpandedLocCode(const std::string& unexpandedLocCode)
+{
+    if (restoreScopes == 0)
+    {
+        return std::nullopt;
+    }
+
+    auto it = prefetchedData.frusByLocCode.find(unexpandedLocCode);
+    if (it == prefetchedData.frusByLocCode.end())
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+} // namespace prefetch
+} // namespace hw_isolation
@@ -1,7 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
+#include "config.h"
+
 #include "common/isolatable_hardwares.hpp"
 
+#include "common/dbus_prefetch.hpp"
 #include "common/utils.hpp"
 
 #include <attributes_info.H>
@@ -200,6 +203,70 @@ IsolatableHWs::IsolatableHWs(sdbusplus::bus::bus& bus) : _bus(bus)
                                    inv_path_lookup_func::itemPrettyName,
                                    "Oscillator Reference Clock")},
     };
+
+    // Watch the inventory changes to retry the hardwares which inventory
+    // path could not be resolved.
+    try
+    {
+        namespace sdbusplus_match = sdbusplus::bus::match;
+
+        constexpr auto inventoryObjPath = "/xyz/openbmc_project/inventory";
+        auto invalidate = [this](sdbusplus::message::message&) {
+            this->invalidateUnresolved();
+        };
+
+        _inventoryWatchers.push_back(std::make_unique<sdbusplus_match::match>(
+            _bus, sdbusplus_match::rules::interfacesAdded(inventoryObjPath),
+            invalidate));
+
+        _inventoryWatchers.push_back(std::make_unique<sdbusplus_match::match>(
+            _bus, sdbusplus_match::rules::interfacesRemoved(inventoryObjPath),
+            invalidate));
+
+        // The inventory item presence and the VPD (location code) changes
+        for (const auto& iface :
+             {"xyz.openbmc_project.Inventory.Item", "com.ibm.ipzvpd.Location",
+              "xyz.openbmc_project.Inventory.Decorator.LocationCode"})
+        {
+            _inventoryWatchers.push_back(
+                std::make_unique<sdbusplus_match::match>(
+                    _bus,
+                    sdbusplus_match::rules::type::signal() +
+                        sdbusplus_match::rules::member("PropertiesChanged") +
+                        sdbusplus_match::rules::interface(
+                            "org.freedesktop.DBus.Properties") +
+                        sdbusplus_match::rules::path_namespace(
+                            inventoryObjPath) +
+                        sdbusplus_match::rules::argN(0, iface),
+                    invalidate));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        // The unresolved hardwares will be retried only after restarting
+        // the application.
+        log<level::ERR>(
+            std::format("Exception [{}] while adding the inventory D-Bus "
+                        "match rules",
+                        e.what())
+                .c_str());
+    }
+}
+
+bool IsolatableHWs::isKnownUnresolved(
+    const devtree::EntityPathKey& physicalPath)
+{
+    return _unresolvedHws.contains(physicalPath);
+}
+
+void IsolatableHWs::setUnresolved(const devtree::EntityPathKey& physicalPath)
+{
+    _unresolvedHws.emplace(physicalPath);
+}
+
+void IsolatableHWs::invalidateUnresolved()
+{
+    _unresolvedHws.clear();
 }
 
 std::optional<
@@ -578,8 +645,14 @@ std::optional<devtree::DevTreePhysPath> IsolatableHWs::getPhysicalPath(
 
 std::optional<std::vector<sdbusplus::message::object_path>>
     IsolatableHWs::getInventoryPathsByLocCode(
-        const LocationCode& unexpandedLocCode)
+        sdbusplus::bus::bus& bus, const LocationCode& unexpandedLocCode) const
 {
+    if (auto frus = prefetch::getFRUsByUnexpandedLocCode(unexpandedLocCode);
+        frus.has_value())
+    {
+        return frus;
+    }
+
     constexpr auto vpdMgrObjPath = "/com/ibm/VPD/Manager";
     constexpr auto vpdInterface = "com.ibm.VPD.Manager";
 
@@ -591,15 +664,15 @@ std::optional<std::vector<sdbusplus::message::object_path>>
         //        but, mapper failing when using "com.ibm.VPD" dbus tree.
         std::string dbusServiceName{"com.ibm.VPD.Manager"};
 
-        auto method = _bus.new_method_call(dbusServiceName.c_str(),
-                                           vpdMgrObjPath, vpdInterface,
-                                           "GetFRUsByUnexpandedLocationCode");
+        auto method = bus.new_method_call(dbusServiceName.c_str(),
+                                          vpdMgrObjPath, vpdInterface,
+                                          "GetFRUsByUnexpandedLocationCode");
 
         // passing 0 as node number
         // FIXME if enabled multi node system
         method.append(unexpandedLocCode, static_cast<uint16_t>(0));
 
-        auto resp = _bus.call(method);
+        auto resp = bus.call(method);
 
         resp.read(listOfInventoryObjPaths);
     }
@@ -677,10 +750,12 @@ std::optional<struct pdbg_target*>
 
 std::optional<sdbusplus::message::object_path>
     IsolatableHWs::getFRUInventoryPath(
+        sdbusplus::bus::bus& bus,
         const std::pair<LocationCode, InstanceId>& fruDetails,
         const inv_path_lookup_func::LookupFuncForInvPath& fruInvPathLookupFunc)
+        const
 {
-    auto inventoryPathList = getInventoryPathsByLocCode(fruDetails.first);
+    auto inventoryPathList = getInventoryPathsByLocCode(bus, fruDetails.first);
     if (!inventoryPathList.has_value())
     {
         return std::nullopt;
@@ -717,8 +792,8 @@ std::optional<sdbusplus::message::object_path>
 
         auto fruHwInvPath = std::find_if(
             inventoryPathList->begin(), inventoryPathList->end(),
-            [&fruInstId, &fruInvPathLookupFunc, this](const auto& path) {
-            return fruInvPathLookupFunc(this->_bus, path, fruInstId);
+            [&fruInstId, &fruInvPathLookupFunc, &bus](const auto& path) {
+            return fruInvPathLookupFunc(bus, path, fruInstId);
         });
 
         if (fruHwInvPath == inventoryPathList->end())
@@ -735,14 +810,13 @@ std::optional<sdbusplus::message::object_path>
 }
 
 std::optional<sdbusplus::message::object_path>
-    IsolatableHWs::getClkParentFruObjPath(struct pdbg_target* clkTgt)
+    IsolatableHWs::getClkParentFruObjPath(
+        sdbusplus::bus::bus& bus, const std::string& clkTgtDevTreePath) const
 {
-    auto clkTgtDevTreePath{pdbg_target_path(clkTgt)};
-
     constexpr auto MotherboardIface =
         "xyz.openbmc_project.Inventory.Item.Board.Motherboard";
     auto parentFruPath = utils::getChildsInventoryPath(
-        _bus, std::string("/xyz/openbmc_project/inventory"), MotherboardIface);
+        bus, std::string("/xyz/openbmc_project/inventory"), MotherboardIface);
 
     if (!parentFruPath.has_value())
     {
@@ -775,14 +849,14 @@ std::optional<sdbusplus::message::object_path>
     return (*parentFruPath)[0];
 }
 
-std::optional<sdbusplus::message::object_path>
-    IsolatableHWs::getParentFruObjPath(struct pdbg_target* childTgt)
+bool IsolatableHWs::addParentFruToPlan(struct pdbg_target* childTgt,
+                                       InventoryPathPlan& plan)
 {
     if (childTgt == nullptr)
     {
         log<level::ERR>(
             "Given pdbg target is invalid, failed to get parent fru path");
-        return std::nullopt;
+        return false;
     }
 
     auto childTgtDevTreePath{pdbg_target_path(childTgt)};
@@ -795,7 +869,7 @@ std::optional<sdbusplus::message::object_path>
                         "please make sure hardware unit is added in the pdbg",
                         childTgtDevTreePath)
                 .c_str());
-        return std::nullopt;
+        return false;
     }
 
     /**
@@ -805,13 +879,14 @@ std::optional<sdbusplus::message::object_path>
      */
     if (strcmp(pdbgTgtClass, "oscrefclk") == 0)
     {
-        return getClkParentFruObjPath(childTgt);
+        plan.fruDetails.reset();
+        return true;
     }
 
     auto parentFruTgt = getParentFruPhalDevTreeTgt(childTgt);
     if (!parentFruTgt.has_value())
     {
-        return std::nullopt;
+        return false;
     }
 
     std::string parentFruTgtPdbgClass{pdbg_target_class_name(*parentFruTgt)};
@@ -827,28 +902,17 @@ std::optional<sdbusplus::message::object_path>
                         "not found in the isolatable hardware list",
                         childTgtDevTreePath, parentFruTgtPdbgClass)
                 .c_str());
-        return std::nullopt;
-    }
-
-    auto parentFruHwInfo = devtree::getFRUDetails(*parentFruTgt);
-
-    auto parentFruPath = getFRUInventoryPath(
-        parentFruHwInfo, parentFruHwDetails->second._invPathFuncLookUp);
-    if (!parentFruPath.has_value())
-    {
-        log<level::ERR>(
-            std::format("Failed to get get parent fru inventory path "
-                        "for given device path [{}]",
-                        childTgtDevTreePath)
-                .c_str());
-        return std::nullopt;
+        return false;
     }
 
-    return parentFruPath;
+    plan.fruDetails = devtree::getFRUDetails(*parentFruTgt);
+    plan.fruInvPathLookupFunc = parentFruHwDetails->second._invPathFuncLookUp;
+    return true;
 }
 
-std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
-    const devtree::DevTreePhysPath& physicalPath, bool& persistedCoreEcoMode)
+std::optional<IsolatableHWs::InventoryPathPlan>
+    IsolatableHWs::getInventoryPathPlan(
+        const devtree::EntityPathKey& physicalPath, bool& persistedCoreEcoMode)
 {
     try
     {
@@ -857,7 +921,9 @@ std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
         {
             return std::nullopt;
         }
-        auto isolatedHwTgtDevTreePath = pdbg_target_path(*isolatedHwTgt);
+
+        InventoryPathPlan plan;
+        plan.devTreePath = pdbg_target_path(*isolatedHwTgt);
 
         auto pdbgTgtClass{pdbg_target_class_name(*isolatedHwTgt)};
         if (pdbgTgtClass == nullptr)
@@ -866,7 +932,7 @@ std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
                 std::format("The given hardware [{}] pdbg target class "
                             "is missing, please make sure hardware unit "
                             "is added in pdbg ",
-                            isolatedHwTgtDevTreePath)
+                            plan.devTreePath)
                     .c_str());
             return std::nullopt;
         }
@@ -933,162 +999,234 @@ std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
             log<level::ERR>(
                 std::format("Isolated hardware [{}] pdbg class [{}] is "
                             "not found in isolatable hardware list",
-                            isolatedHwTgtDevTreePath, isolatedHwPdbgClass)
+                            plan.devTreePath, isolatedHwPdbgClass)
                     .c_str());
             return std::nullopt;
         }
 
-        sdbusplus::message::object_path isolatedHwInventoryPath;
-        if (isolatedHwDetails->second._isItFRU)
+        plan.isItFRU = isolatedHwDetails->second._isItFRU;
+        if (plan.isItFRU)
         {
-            auto isolatedHwInfo = devtree::getFRUDetails(*isolatedHwTgt);
+            plan.fruDetails = devtree::getFRUDetails(*isolatedHwTgt);
+            plan.fruInvPathLookupFunc =
+                isolatedHwDetails->second._invPathFuncLookUp;
+            return plan;
+        }
+
+        if (!addParentFruToPlan(*isolatedHwTgt, plan))
+        {
+            return std::nullopt;
+        }
+
+        plan.childIfaceName = isolatedHwDetails->first._interfaceName._name;
+        plan.invPathLookupFunc = isolatedHwDetails->second._invPathFuncLookUp;
 
-            auto inventoryPath = getFRUInventoryPath(
-                isolatedHwInfo, isolatedHwDetails->second._invPathFuncLookUp);
-            if (!inventoryPath.has_value())
+        /**
+         * If the isolated hardware inventory item interface is
+         * CommonInventoryItemIface ("xyz.openbmc_project.Inventory.Item")
+         * then, use PrettyName as unique hardware id because currently
+         * few isolatbale hardware subunits is not modelled in the BMC
+         * Inventory and Redfish so those subunits need to look based on
+         * the PrettyName to get inventory path.
+         */
+        if (plan.childIfaceName == CommonInventoryItemIface)
+        {
+            plan.uniqueHwId = isolatedHwDetails->second._prettyName;
+            // Workaround for bonnell
+            if (isolatedHwId._pdbgClassName._name == "ocmb" ||
+                isolatedHwId._pdbgClassName._name == "mem_port")
             {
-                log<level::ERR>(std::format("Failed to get inventory path for "
-                                            "given device path [{}]",
-                                            isolatedHwTgtDevTreePath)
-                                    .c_str());
-                return std::nullopt;
-            }
+                std::string type;
+                std::map<int, std::string> tarMap;
+                /* Creating a map with FAPI_POS as key and Inventory Pretty
+                 Name Suffix as Value*/
+                if (isolatedHwId._pdbgClassName._name == "ocmb")
+                {
+                    type = "OpenCAPI Memory Buffer";
+                    tarMap = {{4, "2A"}, {5, "2B"}, {6, "3A"}, {7, "3B"}};
+                }
+                else
+                {
+                    type = "DDR Memory Port";
+                    tarMap = {{8, "2A"}, {10, "2B"}, {12, "3A"}, {14, "3B"}};
+                }
 
-            isolatedHwInventoryPath = *inventoryPath;
+                // The suffix will be used only if more than one identical
+                // target is having the same location code in the inventory
+                // and that will be decided while resolving the plan.
+                ATTR_FAPI_POS_Type fapi;
+                if (!DT_GET_PROP(ATTR_FAPI_POS, isolatedHwTgt.value(), fapi))
+                {
+                    plan.prettyNameSuffix = std::make_pair(type, tarMap[fapi]);
+                }
+            }
         }
         else
         {
-            auto parentFruPath = getParentFruObjPath(*isolatedHwTgt);
-            if (!parentFruPath.has_value())
+            // TODO Below decision need to be based on system core mode
+            //     i.e whether need to use "fc" (in big core system) or
+            //     "core" (in small core system) pdbg target class to get
+            //     the appropriate target physical path from the phal
+            //     cec device tree but, now using the "fc".
+            if (isolatedHwPdbgClass == "core")
             {
-                return std::nullopt;
+                struct pdbg_target* parentFc =
+                    pdbg_target_parent("fc", *isolatedHwTgt);
+                if (parentFc == nullptr)
+                {
+                    log<level::ERR>(
+                        std::format("Failed to get the parent FC "
+                                    "target for the given device tree "
+                                    "target path [{}]",
+                                    plan.devTreePath)
+                            .c_str());
+                    return std::nullopt;
+                }
+                plan.uniqueHwId = devtree::getHwInstIdFromDevTree(parentFc);
             }
-
-            auto childsInventoryPath = utils::getChildsInventoryPath(
-                _bus, *parentFruPath,
-                isolatedHwDetails->first._interfaceName._name);
-            if (!childsInventoryPath.has_value())
+            else
             {
-                return std::nullopt;
+                plan.uniqueHwId =
+                    devtree::getHwInstIdFromDevTree(*isolatedHwTgt);
             }
+        }
+        return plan;
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(std::format("Exception [{}]", e.what()).c_str());
+        return std::nullopt;
+    }
+}
 
-            /**
-             * If the isolated hardware inventory item interface is
-             * CommonInventoryItemIface ("xyz.openbmc_project.Inventory.Item")
-             * then, use PrettyName as unique hardware id because currently
-             * few isolatbale hardware subunits is not modelled in the BMC
-             * Inventory and Redfish so those subunits need to look based on
-             * the PrettyName to get inventory path.
-             */
-            inv_path_lookup_func::UniqueHwId uniqIsolateHwKey;
-            if (isolatedHwDetails->first._interfaceName._name ==
-                CommonInventoryItemIface)
+std::optional<sdbusplus::message::object_path>
+    IsolatableHWs::resolveInventoryPath(sdbusplus::bus::bus& bus,
+                                        const InventoryPathPlan& plan) const
+{
+    ResolveCache cache;
+    return resolveInventoryPath(bus, plan, cache);
+}
+
+std::optional<sdbusplus::message::object_path>
+    IsolatableHWs::resolveInventoryPath(sdbusplus::bus::bus& bus,
+                                        const InventoryPathPlan& plan,
+                                        ResolveCache& cache) const
+{
+    try
+    {
+        std::optional<sdbusplus::message::object_path> fruPath;
+        if (plan.fruDetails.has_value())
+        {
+            auto fruPathIt = cache.fruPaths.find(*plan.fruDetails);
+            if (fruPathIt == cache.fruPaths.end())
             {
-                uniqIsolateHwKey = isolatedHwDetails->second._prettyName;
-                // Workaround for bonnell
-                if (isolatedHwId._pdbgClassName._name == "ocmb" ||
-                    isolatedHwId._pdbgClassName._name == "mem_port")
-                {
-                    std::string type;
-                    std::map<int, std::string> tarMap;
-                    /* Creating a map with FAPI_POS as key and Inventory Pretty
-                     Name Suffix as Value*/
-                    if (isolatedHwId._pdbgClassName._name == "ocmb")
-                    {
-                        type = "OpenCAPI Memory Buffer";
-                        tarMap = {{4, "2A"}, {5, "2B"}, {6, "3A"}, {7, "3B"}};
-                    }
-                    else
-                    {
-                        type = "DDR Memory Port";
-                        tarMap = {
-                            {8, "2A"}, {10, "2B"}, {12, "3A"}, {14, "3B"}};
-                    }
-                    const auto& vec = childsInventoryPath.value();
-                    int targetsWithSameLocCodeCount = 0;
-
-                    /*Getting the count of identical targets with same Location
-                    Code in Inventory. We will have only one target with same
-                    Location Code in case of rainier and everest. But On
-                    bonnell, we can have more than one identical target with
-                    same Location Code. Based on count, we will handle it
-                    differently for rainier,everest and bonnell*/
-                    for (const auto& path : vec)
-                    {
-                        auto retPrettyName =
-                            utils::getDBusPropertyVal<std::string>(
-                                this->_bus, path.str,
-                                "xyz.openbmc_project.Inventory.Item",
-                                "PrettyName");
-                        if (retPrettyName.find(type) != std::string::npos)
-                            targetsWithSameLocCodeCount += 1;
-                        if (targetsWithSameLocCodeCount > 1)
-                            break;
-                    }
-                    ATTR_FAPI_POS_Type fapi;
-                    // Mapping to correct PrettyName using FAPI_POS of the
-                    // target
-                    if (targetsWithSameLocCodeCount > 1 &&
-                        !DT_GET_PROP(ATTR_FAPI_POS, isolatedHwTgt.value(),
-                                     fapi))
-                    {
-                        uniqIsolateHwKey =
-                            isolatedHwDetails->second._prettyName + " " +
-                            tarMap[fapi];
-                    }
-                }
+                fruPathIt = cache.fruPaths
+                                .emplace(*plan.fruDetails,
+                                         getFRUInventoryPath(
+                                             bus, *plan.fruDetails,
+                                             plan.fruInvPathLookupFunc))
+                                .first;
             }
-            else
+            fruPath = fruPathIt->second;
+        }
+        else if (!plan.isItFRU)
+        {
+            if (!cache.clkParentFruPath.has_value())
             {
-                // TODO Below decision need to be based on system core mode
-                //     i.e whether need to use "fc" (in big core system) or
-                //     "core" (in small core system) pdbg target class to get
-                //     the appropriate target physical path from the phal
-                //     cec device tree but, now using the "fc".
-                if (isolatedHwPdbgClass == "core")
-                {
-                    struct pdbg_target* parentFc =
-                        pdbg_target_parent("fc", *isolatedHwTgt);
-                    if (parentFc == nullptr)
-                    {
-                        log<level::ERR>(
-                            std::format("Failed to get the parent FC "
-                                        "target for the given device tree "
-                                        "target path [{}]",
-                                        isolatedHwTgtDevTreePath)
-                                .c_str());
-                        return std::nullopt;
-                    }
-                    uniqIsolateHwKey =
-                        devtree::getHwInstIdFromDevTree(parentFc);
-                }
-                else
-                {
-                    uniqIsolateHwKey =
-                        devtree::getHwInstIdFromDevTree(*isolatedHwTgt);
-                }
+                cache.clkParentFruPath =
+                    getClkParentFruObjPath(bus, plan.devTreePath);
             }
+            fruPath = *cache.clkParentFruPath;
+        }
 
-            auto isolateHwPath = std::find_if(
-                childsInventoryPath->begin(), childsInventoryPath->end(),
-                [&uniqIsolateHwKey, &isolatedHwDetails,
-                 this](const auto& path) {
-                return isolatedHwDetails->second._invPathFuncLookUp(
-                    this->_bus, path, uniqIsolateHwKey);
-            });
-
-            if (isolateHwPath == childsInventoryPath->end())
+        if (!fruPath.has_value())
+        {
+            if (plan.isItFRU)
             {
                 log<level::ERR>(std::format("Failed to get inventory path for "
                                             "given device path [{}]",
-                                            isolatedHwTgtDevTreePath)
+                                            plan.devTreePath)
                                     .c_str());
-                return std::nullopt;
             }
+            else
+            {
+                log<level::ERR>(
+                    std::format("Failed to get get parent fru inventory path "
+                                "for given device path [{}]",
+                                plan.devTreePath)
+                        .c_str());
+            }
+            return std::nullopt;
+        }
+
+        if (plan.isItFRU)
+        {
+            return fruPath;
+        }
+
+        auto childsKey = std::make_pair(fruPath->str, plan.childIfaceName);
+        auto childsIt = cache.childsInventoryPaths.find(childsKey);
+        if (childsIt == cache.childsInventoryPaths.end())
+        {
+            childsIt = cache.childsInventoryPaths
+                           .emplace(childsKey, utils::getChildsInventoryPath(
+                                                   bus, *fruPath,
+                                                   plan.childIfaceName))
+                           .first;
+        }
+
+        const auto& childsInventoryPath = childsIt->second;
+        if (!childsInventoryPath.has_value())
+        {
+            return std::nullopt;
+        }
+
+        auto uniqIsolateHwKey = plan.uniqueHwId;
+        if (plan.prettyNameSuffix.has_value())
+        {
+            const auto& [type, suffix] = *plan.prettyNameSuffix;
+
+            /*Getting the count of identical targets with same Location
+            Code in Inventory. We will have only one target with same
+            Location Code in case of rainier and everest. But On
+            bonnell, we can have more than one identical target with
+            same Location Code. Based on count, we will handle it
+            differently for rainier,everest and bonnell*/
+            int targetsWithSameLocCodeCount = 0;
+            for (const auto& path : *childsInventoryPath)
+            {
+                auto retPrettyName = utils::getDBusPropertyVal<std::string>(
+                    bus, path.str, "xyz.openbmc_project.Inventory.Item",
+                    "PrettyName");
+                if (retPrettyName.find(type) != std::string::npos)
+                    targetsWithSameLocCodeCount += 1;
+                if (targetsWithSameLocCodeCount > 1)
+                    break;
+            }
+
+            // Mapping to correct PrettyName using FAPI_POS of the target
+            if (targetsWithSameLocCodeCount > 1)
+            {
+                uniqIsolateHwKey = std::get<std::string>(plan.uniqueHwId) +
+                                   " " + suffix;
+            }
+        }
 
-            isolatedHwInventoryPath = *isolateHwPath;
+        auto isolateHwPath = std::find_if(
+            childsInventoryPath->begin(), childsInventoryPath->end(),
+            [&uniqIsolateHwKey, &plan, &bus](const auto& path) {
+            return plan.invPathLookupFunc(bus, path, uniqIsolateHwKey);
+        });
+
+        if (isolateHwPath == childsInventoryPath->end())
+        {
+            log<level::ERR>(std::format("Failed to get inventory path for "
+                                        "given device path [{}]",
+                                        plan.devTreePath)
+                                .c_str());
+            return std::nullopt;
         }
-        return isolatedHwInventoryPath;
+        return *isolateHwPath;
     }
     catch (const std::exception& e)
     {
@@ -1097,6 +1235,56 @@ std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
     }
 }
 
+std::vector<std::optional<sdbusplus::message::object_path>>
+    IsolatableHWs::resolveMany(
+        const std::vector<devtree::EntityPathKey>& physPaths)
+{
+    std::vector<std::optional<sdbusplus::message::object_path>> inventoryPaths(
+        physPaths.size());
+
+    // Group the plans by the parent FRU to resolve the parent FRU and
+    // its childs only once for all the hardwares which are in the same FRU.
+    std::map<std::optional<std::pair<LocationCode, InstanceId>>,
+             std::vector<std::pair<std::size_t, InventoryPathPlan>>>
+        plansByFru;
+    for (std::size_t index = 0; index < physPaths.size(); index++)
+    {
+        if (isKnownUnresolved(physPaths[index]))
+        {
+            continue;
+        }
+
+        bool ecoCore{false};
+        auto plan = getInventoryPathPlan(physPaths[index], ecoCore);
+        if (plan.has_value())
+        {
+            auto fruDetails = plan->fruDetails;
+            plansByFru[fruDetails].emplace_back(index, std::move(*plan));
+        }
+    }
+
+    for (const auto& [fruDetails, plans] : plansByFru)
+    {
+        ResolveCache cache;
+        for (const auto& [index, plan] : plans)
+        {
+            inventoryPaths[index] = resolveInventoryPath(_bus, plan, cache);
+        }
+    }
+    return inventoryPaths;
+}
+
+std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
+    const devtree::EntityPathKey& physicalPath, bool& persistedCoreEcoMode)
+{
+    auto plan = getInventoryPathPlan(physicalPath, persistedCoreEcoMode);
+    if (!plan.has_value())
+    {
+        return std::nullopt;
+    }
+    return resolveInventoryPath(_bus, *plan);
+}
+
 } // namespace isolatable_hws
 
 namespace inv_path_lookup_func
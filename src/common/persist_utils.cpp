@@ -0,0 +1,330 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/persist_utils.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <utility>
+
+namespace hw_isolation
+{
+namespace persist
+{
+
+using namespace phosphor::logging;
+
+/**
+ * The batch which is failed to flush is retried after this interval
+ * instead of in the next idle to avoid spinning on the persistent failure.
+ */
+constexpr auto syncRetryInterval = std::chrono::seconds(5);
+
+namespace
+{
+
+fs::path getTmpPath(const fs::path& path)
+{
+    return fs::path(path.string() + ".tmp");
+}
+
+bool writeFile(const fs::path& path, const std::string& data)
+{
+    try
+    {
+        std::ofstream os(path, std::ios::binary | std::ios::trunc);
+        os.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+        os.write(data.data(), data.size());
+        os.close();
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(std::format("Exception: [{}] while writing the "
+                                    "file [{}]",
+                                    e.what(), path.string())
+                            .c_str());
+        std::error_code ec;
+        fs::remove(path, ec);
+        return false;
+    }
+}
+
+bool syncPath(const fs::path& path, const int flags)
+{
+    int fd = ::open(path.c_str(), flags | O_CLOEXEC);
+    if (fd < 0)
+    {
+        log<level::ERR>(std::format("Failed to open [{}] to sync errorno [{}] "
+                                    "and errormsg [{}]",
+                                    path.string(), errno, strerror(errno))
+                            .c_str());
+        return false;
+    }
+
+    bool synced = fsync(fd) == 0;
+    if (!synced)
+    {
+        log<level::ERR>(std::format("Failed to sync [{}] errorno [{}] "
+                                    "and errormsg [{}]",
+                                    path.string(), errno, strerror(errno))
+                            .c_str());
+    }
+    close(fd);
+    return synced;
+}
+
+} // namespace
+
+uint32_t crc32(const uint8_t* data, std::size_t size, uint32_t crc)
+{
+    // The persisted records are small so, computing bitwise
+    // instead of keeping the lookup table.
+    crc = ~crc;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+std::optional<uint64_t> hashFile(const fs::path& path)
+{
+    std::ifstream is(path, std::ios::in | std::ios::binary);
+    if (!is)
+    {
+        return std::nullopt;
+    }
+
+    uint64_t hashVal{0xcbf29ce484222325ULL};
+    std::array<char, 4096> buf;
+    while (is.read(buf.data(), buf.size()) || (is.gcount() > 0))
+    {
+        for (std::streamsize i = 0; i < is.gcount(); i++)
+        {
+            hashVal ^= static_cast<uint8_t>(buf[i]);
+            hashVal *= 0x100000001b3ULL;
+        }
+    }
+
+    if (is.bad())
+    {
+        return std::nullopt;
+    }
+    return hashVal;
+}
+
+bool writeFileAtomically(const fs::path& path, const std::string& data)
+{
+    auto tmpPath = getTmpPath(path);
+    if (!writeFile(tmpPath, data) || !syncPath(tmpPath, O_RDONLY))
+    {
+        std::error_code ec;
+        fs::remove(tmpPath, ec);
+        return false;
+    }
+
+    std::error_code ec;
+    fs::rename(tmpPath, path, ec);
+    if (ec)
+    {
+        log<level::ERR>(std::format("Failed to replace [{}] error [{}]",
+                                    path.string(), ec.message())
+                            .c_str());
+        fs::remove(tmpPath, ec);
+        return false;
+    }
+
+    // Make the rename durable
+    return syncPath(path.parent_path(), O_RDONLY | O_DIRECTORY);
+}
+
+GroupCommit::GroupCommit(const sdeventplus::Event& eventLoop,
+                         const std::string& path) :
+    _commitSource(eventLoop,
+                  [this](sdeventplus::source::EventBase&) { commit(); }),
+    _retryTimer(eventLoop, [this]() { arm(); })
+{
+    std::error_code ec;
+    fs::create_directories(path, ec);
+
+    // Commit only when no other event is pending to make the batch
+    // as big as possible.
+    _commitSource.set_priority(SD_EVENT_PRIORITY_IDLE);
+    _commitSource.set_enabled(sdeventplus::source::Enabled::Off);
+}
+
+GroupCommit::~GroupCommit()
+{
+    if (!_writers.empty())
+    {
+        log<level::ERR>(std::format("Dropping [{}] scheduled writers which "
+                                    "are not committed",
+                                    _writers.size())
+                            .c_str());
+    }
+
+    // The writers and syncers might be using the destroyed objects
+    // (the objects which are updated in place are synced while destroying).
+    _writers.clear();
+    _syncers.clear();
+
+    // Remove the staged files if those are failed to commit
+    // to avoid leaving the temporary files.
+    if (!commitBatch())
+    {
+        for (const auto& path : _stagedFiles)
+        {
+            std::error_code ec;
+            fs::remove(getTmpPath(path), ec);
+        }
+    }
+}
+
+void GroupCommit::arm()
+{
+    _commitSource.set_enabled(sdeventplus::source::Enabled::OneShot);
+}
+
+void GroupCommit::schedule(const std::string& name, Writer&& writer)
+{
+    _writers.insert_or_assign(name, std::move(writer));
+    arm();
+}
+
+void GroupCommit::requestSync(const std::string& name, Syncer&& syncer)
+{
+    _syncers.insert_or_assign(name, std::move(syncer));
+    arm();
+}
+
+void GroupCommit::syncNow(const std::string& name)
+{
+    auto it = _syncers.find(name);
+    if (it == _syncers.end())
+    {
+        return;
+    }
+
+    if (!it->second())
+    {
+        log<level::ERR>(
+            std::format("Failed to sync [{}] immediately", name).c_str());
+    }
+    _syncers.erase(it);
+}
+
+void GroupCommit::stageFile(const fs::path& path, const std::string& data)
+{
+    if (writeFile(getTmpPath(path), data))
+    {
+        _stagedFiles.emplace(path);
+        arm();
+    }
+}
+
+void GroupCommit::stageRemove(const fs::path& path)
+{
+    std::error_code ec;
+    if (_stagedFiles.erase(path) > 0)
+    {
+        fs::remove(getTmpPath(path), ec);
+    }
+
+    if (fs::remove(path, ec))
+    {
+        _updatedDirs.emplace(path.parent_path());
+        arm();
+    }
+}
+
+bool GroupCommit::commitBatch()
+{
+    // Flush the batch data before renaming so that the replaced files
+    // never point to the partially written data.
+    bool synced{true};
+    for (auto it = _syncers.begin(); it != _syncers.end();)
+    {
+        if (it->second())
+        {
+            it = _syncers.erase(it);
+            continue;
+        }
+
+        log<level::ERR>(std::format("Failed to sync [{}]", it->first).c_str());
+        synced = false;
+        ++it;
+    }
+
+    for (const auto& path : _stagedFiles)
+    {
+        synced = syncPath(getTmpPath(path), O_RDONLY) && synced;
+    }
+
+    if (!synced)
+    {
+        return false;
+    }
+
+    for (const auto& path : std::exchange(_stagedFiles, {}))
+    {
+        std::error_code ec;
+        fs::rename(getTmpPath(path), path, ec);
+        if (ec)
+        {
+            log<level::ERR>(std::format("Failed to replace [{}] error [{}]",
+                                        path.string(), ec.message())
+                                .c_str());
+            fs::remove(getTmpPath(path), ec);
+            continue;
+        }
+        _updatedDirs.emplace(path.parent_path());
+    }
+
+    // Make the renames and removes durable
+    for (auto it = _updatedDirs.begin(); it != _updatedDirs.end();)
+    {
+        if (syncPath(*it, O_RDONLY | O_DIRECTORY))
+        {
+            it = _updatedDirs.erase(it);
+            continue;
+        }
+        synced = false;
+        ++it;
+    }
+    return synced;
+}
+
+void GroupCommit::commit()
+{
+    // Take the scheduled writers since the writer may schedule
+    // the writers for the next batch.
+    auto writers = std::exchange(_writers, {});
+    for (auto& [name, writer] : writers)
+    {
+        writer();
+    }
+
+    if (!commitBatch())
+    {
+        log<level::ERR>(std::format("Failed to commit the persisted data, "
+                                    "retrying after [{}] seconds",
+                                    syncRetryInterval.count())
+                            .c_str());
+        _retryTimer.restartOnce(syncRetryInterval);
+    }
+}
+
+} // namespace persist
+} // namespace hw_isolation
@@ -16,9 +16,8 @@ extern "C"
 #include <phosphor-logging/elog-errors.hpp>
 
 #include <format>
-#include <iomanip>
-#include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace hw_isolation
 {
@@ -32,20 +31,16 @@ using namespace phosphor::logging;
  * usage.
  */
 constexpr int continueTgtTraversal = 0;
-constexpr int requireIsolateHwFound = 1;
 
-struct CecDevTreeHw
-{
-    ATTR_PHYS_BIN_PATH_Type physBinPath;
-
-    struct pdbg_target* reqDevTreeHw;
+/**
+ * @brief The phal cec device tree targets index by their physical path
+ */
+static std::unordered_map<EntityPathKey, struct pdbg_target*> physPathIndex;
 
-    CecDevTreeHw()
-    {
-        memset(&physBinPath, 0, sizeof(physBinPath));
-        reqDevTreeHw = nullptr;
-    }
-};
+/**
+ * @brief Used to indicate whether the physPathIndex is built
+ */
+static bool physPathIndexBuilt{false};
 
 void initPHAL()
 {
@@ -139,22 +134,19 @@ DevTreePhysPath getPhysicalPath(struct pdbg_target* isolateHw)
 }
 
 /**
- * @brief pdbg callback to identify a target based on the given
- *        attribute
+ * @brief pdbg callback to add the target into the physical path index
  *
  * @param[in] target current device tree target
- * @param[in|out] userData for accessing|storing from|to user
+ * @param[in] userData unused
  *
- * @return 0 to continue traverse, non-zero to stop traverse
+ * @return 0 to continue traverse
  */
-int pdbgCallbackToGetTgt(struct pdbg_target* target, void* userData)
+int pdbgCallbackToIndexTgt(struct pdbg_target* target, void* /* userData */)
 {
-    CecDevTreeHw* cecDevTreeHw = static_cast<CecDevTreeHw*>(userData);
-
     /**
-     * The use case is, find the target from the cec device tree based on the
-     * given attribute value. So, don't use "DT_GET_PROP" to read attribute
-     * because it will add trace if the given attribute is not found to read.
+     * All the targets are not having the physical path so, don't use
+     * "DT_GET_PROP" to read attribute because it will add trace
+     * if the given attribute is not found to read.
      */
     ATTR_PHYS_BIN_PATH_Type physBinPath;
     if (!pdbg_target_get_attribute(
@@ -165,54 +157,57 @@ int pdbgCallbackToGetTgt(struct pdbg_target* target, void* userData)
         return continueTgtTraversal;
     }
 
-    if (memcmp(physBinPath, cecDevTreeHw->physBinPath, sizeof(physBinPath)) !=
-        0)
+    // Keep the first found target as like the traversal lookup
+    physPathIndex.emplace(EntityPathKey(physBinPath, sizeof(physBinPath)),
+                          target);
+
+    return continueTgtTraversal;
+}
+
+void buildPhysPathIndex()
+{
+    if (physPathIndexBuilt)
     {
-        return continueTgtTraversal;
+        return;
     }
 
-    // Found the required cec device tree target (hardware)
-    cecDevTreeHw->reqDevTreeHw = target;
-
-    return requireIsolateHwFound;
+    pdbg_target_traverse(NULL, pdbgCallbackToIndexTgt, nullptr);
+    physPathIndexBuilt = true;
 }
 
 std::optional<struct pdbg_target*>
     getPhalDevTreeTgt(const DevTreePhysPath& physicalPath)
 {
-    CecDevTreeHw cecDevTreeHw;
-
-    size_t physBinPathSize = sizeof(cecDevTreeHw.physBinPath);
-    if (physBinPathSize < physicalPath.size())
+    if (EntityPathKey::maxSize < physicalPath.size())
     {
         log<level::ERR>(std::format("EntityPath size is mismatch. "
                                     " Given size [{}] and Expected size [{}]",
-                                    physicalPath.size(), physBinPathSize)
+                                    physicalPath.size(),
+                                    EntityPathKey::maxSize)
                             .c_str());
         return std::nullopt;
     }
-    std::copy(physicalPath.begin(), physicalPath.end(),
-              cecDevTreeHw.physBinPath);
 
-    auto ret = pdbg_target_traverse(NULL, pdbgCallbackToGetTgt, &cecDevTreeHw);
+    return getPhalDevTreeTgt(
+        EntityPathKey(physicalPath.data(), physicalPath.size()));
+}
 
-    if (ret != requireIsolateHwFound)
-    {
-        std::stringstream ss;
-        std::for_each(physicalPath.begin(), physicalPath.end(),
-                      [&ss](const auto& ele) {
-            ss << std::setw(2) << std::setfill('0') << std::hex << (int)ele
-               << " ";
-        });
+std::optional<struct pdbg_target*>
+    getPhalDevTreeTgt(const EntityPathKey& physicalPath)
+{
+    buildPhysPathIndex();
 
+    auto it = physPathIndex.find(physicalPath);
+    if (it == physPathIndex.end())
+    {
         log<level::ERR>(std::format("Isolated HW [{}] is "
                                     "not found in the cec device tree",
-                                    ss.str())
+                                    physicalPath.toString())
                             .c_str());
         return std::nullopt;
     }
 
-    return cecDevTreeHw.reqDevTreeHw;
+    return it->second;
 }
 
 std::pair<LocationCode, InstanceId> getFRUDetails(struct pdbg_target* fruTgt)
@@ -29,6 +29,12 @@ std::string getDBusServiceName(sdbusplus::bus::bus& bus,
                                const std::string& path,
                                const std::string& interface)
 {
+    if (auto serviceName = prefetch::getServiceName(path, interface);
+        serviceName.has_value())
+    {
+        return *serviceName;
+    }
+
     std::vector<std::pair<std::string, std::vector<std::string>>> servicesName;
 
     try
@@ -333,6 +339,13 @@ std::optional<std::vector<sdbusplus::message::object_path>>
                            const sdbusplus::message::object_path& parentObjPath,
                            const std::string& interfaceName)
 {
+    if (auto childPaths =
+            prefetch::getSubTreePaths(parentObjPath.str, interfaceName);
+        childPaths.has_value())
+    {
+        return childPaths;
+    }
+
     std::vector<sdbusplus::message::object_path> listOfChildsInventoryPath;
 
     try
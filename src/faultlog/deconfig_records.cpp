@@ -1,11 +1,12 @@
 #include <attributes_info.H>
-#include <libphal.H>
 
 #include <deconfig_reason.hpp>
 #include <deconfig_records.hpp>
 #include <libguard/guard_interface.hpp>
 #include <phosphor-logging/lg2.hpp>
 #include <util.hpp>
+
+#include <unordered_set>
 namespace openpower::faultlog
 {
 
@@ -15,55 +16,41 @@ constexpr auto stateConfigured = "CONFIGURED";
 constexpr auto stateDeconfigured = "DECONFIGURED";
 
 /**
- * @brief Get pdbg targets which has been deconfigured
- *
- * This callback function is called as part of the recursive method
- * pdbg_target_traverse, recursion will exit when the method return 1
- * else continues till the target is found
+ * @brief Check whether the pdbg target has been deconfigured
  *
- * @param[in] target - pdbg target to compare
- * @param[inout] priv - data structure to pass to the callback method
+ * @param[in] hwasState - HWAS state of the pdbg target
  *
- * @return 1 when target is found else 0
+ * @return true when target is deconfigured else false
  */
-static int getDeconfigTargets(struct pdbg_target* target, void* priv)
+static bool isDeconfigured(const ATTR_HWAS_STATE_Type& hwasState)
 {
-    auto deconfigList = reinterpret_cast<DeconfigDataList*>(priv);
-    ATTR_HWAS_STATE_Type hwasState;
-    if (!DT_GET_PROP(ATTR_HWAS_STATE, target, hwasState))
+    if ((DECONFIGURED_BY_PLID_MASK & hwasState.deconfiguredByEid) == 0)
     {
-        if ((DECONFIGURED_BY_PLID_MASK & hwasState.deconfiguredByEid) == 0)
+        // inlcude only specific states and other might be by association
+        switch (hwasState.deconfiguredByEid)
         {
-            // inlcude only specific states and other might be by association
-            switch (hwasState.deconfiguredByEid)
+            case DECONFIGURED_BY_MANUAL_GARD:
+            case DECONFIGURED_BY_FIELD_CORE_OVERRIDE:
+            case DECONFIGURED_BY_PRD:
+            case DECONFIGURED_BY_PHYP:
+            case DECONFIGURED_BY_SPCN:
             {
-                case DECONFIGURED_BY_MANUAL_GARD:
-                case DECONFIGURED_BY_FIELD_CORE_OVERRIDE:
-                case DECONFIGURED_BY_PRD:
-                case DECONFIGURED_BY_PHYP:
-                case DECONFIGURED_BY_SPCN:
-                {
-                    deconfigList->addPdbgTarget(target);
-                    break;
-                }
-                default:
-                {
-                    break;
-                }
+                return true;
+            }
+            default:
+            {
+                return false;
             }
-        }
-        else if (hwasState.deconfiguredByEid != 0)
-        {
-            deconfigList->addPdbgTarget(target);
         }
     }
-    return 0;
+    return hwasState.deconfiguredByEid != 0;
 }
 
 DeconfigDataList
-    DeconfigRecords::getDeconfigList(const GuardRecords& guardRecords)
+    DeconfigRecords::getDeconfigList(const GuardRecords& guardRecords,
+                                     const DevTreeSnapshot& devTree)
 {
-    std::vector<std::string> pathList;
+    std::unordered_set<std::string> pathList;
     for (const auto& elem : guardRecords)
     {
         auto physicalPath = openpower::guard::getPhysicalPath(elem.targetId);
@@ -71,84 +58,66 @@ DeconfigDataList
         {
             continue;
         }
-        pathList.push_back(*physicalPath);
+        pathList.emplace(*physicalPath);
     }
 
-    DeconfigDataList deconfigList;
-    pdbg_target_traverse(nullptr, getDeconfigTargets, &deconfigList);
     DeconfigDataList onlyDeconfigList;
-    for (const auto& target : deconfigList.targetList)
+    for (const auto& targetInfo : devTree.targets())
     {
-        ATTR_PHYS_DEV_PATH_Type attrPhyDevPath;
-        if (!DT_GET_PROP(ATTR_PHYS_DEV_PATH, target, attrPhyDevPath))
+        if (!targetInfo.hwasState.has_value() ||
+            !isDeconfigured(*targetInfo.hwasState))
         {
-            std::string phyPathStr(attrPhyDevPath, sizeof(attrPhyDevPath));
-            // consider only those targets that are not part of guard list
-            if (std::find(pathList.begin(), pathList.end(), phyPathStr) ==
-                pathList.end())
-            {
-                onlyDeconfigList.addPdbgTarget(target);
-            }
+            continue;
+        }
+
+        // consider only those targets that are not part of guard list
+        if (!pathList.contains(targetInfo.phyDevPath))
+        {
+            onlyDeconfigList.push_back(&targetInfo);
         }
     }
     return onlyDeconfigList;
 }
 
-int DeconfigRecords::getCount(const GuardRecords& guardRecords)
+int DeconfigRecords::getCount(const GuardRecords& guardRecords,
+                              const DevTreeSnapshot& devTree)
 {
-    return static_cast<int>(getDeconfigList(guardRecords).targetList.size());
+    return static_cast<int>(getDeconfigList(guardRecords, devTree).size());
 }
 
 void DeconfigRecords::populate(const GuardRecords& guardRecords,
+                               const DevTreeSnapshot& devTree,
                                nlohmann::json& jsonNag)
 {
-    DeconfigDataList onlyDeconfigList = getDeconfigList(guardRecords);
+    DeconfigDataList onlyDeconfigList = getDeconfigList(guardRecords, devTree);
 
-    for (const auto& target : onlyDeconfigList.targetList)
+    for (const auto& targetInfo : onlyDeconfigList)
     {
         try
         {
             json deconfigJson = json::object();
-            deconfigJson["TYPE"] = pdbgTargetName(target);
+            deconfigJson["TYPE"] = pdbgTargetName(targetInfo->target);
             std::string state = stateDeconfigured;
-            ATTR_HWAS_STATE_Type hwasState;
-            if (!DT_GET_PROP(ATTR_HWAS_STATE, target, hwasState))
+            // deconfigured list has only the targets with HWAS state
+            const ATTR_HWAS_STATE_Type& hwasState = *targetInfo->hwasState;
+            if (hwasState.functional)
             {
-                if (hwasState.functional)
-                {
-                    state = stateConfigured;
-                }
-                deconfigJson["PLID"] = 0x0;
-                if ((DECONFIGURED_BY_PLID_MASK & hwasState.deconfiguredByEid) !=
-                    0)
-                {
-                    std::stringstream ss;
-                    ss << std::hex << "0x" << hwasState.deconfiguredByEid;
-                    deconfigJson["PLID"] = ss.str();
-                }
-                deconfigJson["REASON_DESCRIPTION"] =
-                    getDeconfigReason(static_cast<DeconfiguredByReason>(
-                        hwasState.deconfiguredByEid));
+                state = stateConfigured;
             }
-            deconfigJson["CURRENT_STATE"] = std::move(state);
-
-            ATTR_PHYS_DEV_PATH_Type attrPhyDevPath;
-            if (!DT_GET_PROP(ATTR_PHYS_DEV_PATH, target, attrPhyDevPath))
+            deconfigJson["PLID"] = 0x0;
+            if ((DECONFIGURED_BY_PLID_MASK & hwasState.deconfiguredByEid) != 0)
             {
-                deconfigJson["PHYS_PATH"] = attrPhyDevPath;
-            }
-            else
-            {
-                // if physical path is not found do not add the record
-                // as it will be of no use
-                continue;
+                std::stringstream ss;
+                ss << std::hex << "0x" << hwasState.deconfiguredByEid;
+                deconfigJson["PLID"] = ss.str();
             }
+            deconfigJson["REASON_DESCRIPTION"] = getDeconfigReason(
+                static_cast<DeconfiguredByReason>(hwasState.deconfiguredByEid));
+            deconfigJson["CURRENT_STATE"] = std::move(state);
+
+            deconfigJson["PHYS_PATH"] = targetInfo->phyDevPath;
 
-            // getLocationCode checks if attr is present in target else
-            // gets it from partent target
-            ATTR_LOCATION_CODE_Type attrLocCode = {'\0'};
-            openpower::phal::pdbg::getLocationCode(target, attrLocCode);
-            deconfigJson["LOCATION_CODE"] = attrLocCode;
+            deconfigJson["LOCATION_CODE"] = targetInfo->locationCode();
 
             json header = json::object();
             header["DECONFIGURED"] = std::move(deconfigJson);
@@ -157,7 +126,8 @@ void DeconfigRecords::populate(const GuardRecords& guardRecords,
         catch (const std::exception& ex)
         {
             lg2::error("Failed to add deconfig records {TARGET} {ERROR}",
-                       "TARGET", pdbgTargetName(target), "ERROR", ex.what());
+                       "TARGET", pdbgTargetName(targetInfo->target), "ERROR",
+                       ex.what());
         }
     }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <devtree_snapshot.hpp>
 #include <libguard/include/guard_record.hpp>
 #include <nlohmann/json.hpp>
 extern "C"
@@ -8,14 +9,7 @@ extern "C"
 }
 namespace openpower::faultlog
 {
-struct DeconfigDataList
-{
-    std::vector<pdbg_target*> targetList;
-    void addPdbgTarget(pdbg_target* tgt)
-    {
-        targetList.push_back(tgt);
-    }
-};
+using DeconfigDataList = std::vector<const TargetInfo*>;
 
 using ::openpower::guard::GuardRecords;
 /**
@@ -42,25 +36,30 @@ class DeconfigRecords
      *  @return 0 if no records are found else count of records
      *  @param[in] guardRecords - list of guarded targets to ignore as part of
      * parsing
+     *  @param[in] devTree - device tree targets details
      */
-    static int getCount(const GuardRecords& guardRecords);
+    static int getCount(const GuardRecords& guardRecords,
+                        const DevTreeSnapshot& devTree);
 
     /** @brief Populate target details that have deconfiguredByEid set
      *
      *  @param[in] guardRecords - list of guarded targets to ignore as part of
+     *  @param[in] devTree - device tree targets details
      *  @param[inout] jsonNag - Update JSON deconfigure records
      * parsing
      */
     static void populate(const GuardRecords& guardRecords,
+                         const DevTreeSnapshot& devTree,
                          nlohmann::json& jsonNag);
 
-  private:
     /** @brief Get pdbg targets for the guard record
      *
      *  @param[in] guardRecords - list of guarded targets to ignore as part of
+     *  @param[in] devTree - device tree targets details
      *  @param[inout] DeconfigDataList - pdbg target list
      * parsing
      */
-    static DeconfigDataList getDeconfigList(const GuardRecords& guardRecords);
+    static DeconfigDataList getDeconfigList(const GuardRecords& guardRecords,
+                                            const DevTreeSnapshot& devTree);
 };
 } // namespace openpower::faultlog
@@ -0,0 +1,81 @@
+#include <libphal.H>
+
+#include <devtree_snapshot.hpp>
+#include <phosphor-logging/lg2.hpp>
+
+#include <cstring>
+
+namespace openpower::faultlog
+{
+
+const std::string& TargetInfo::locationCode() const
+{
+    if (_locationCode.has_value())
+    {
+        return *_locationCode;
+    }
+
+    // getLocationCode checks if attr is present in target else
+    // gets it from parent target
+    ATTR_LOCATION_CODE_Type attrLocCode = {'\0'};
+    try
+    {
+        openpower::phal::pdbg::getLocationCode(target, attrLocCode);
+    }
+    catch (const std::exception& ex)
+    {
+        lg2::error("Failed to get location code for {PATH} {ERROR}", "PATH",
+                   phyDevPath, "ERROR", ex.what());
+    }
+    _locationCode.emplace(attrLocCode,
+                          strnlen(attrLocCode, sizeof(attrLocCode)));
+    return *_locationCode;
+}
+
+DevTreeSnapshot::DevTreeSnapshot()
+{
+    pdbg_target_traverse(nullptr, captureTarget, this);
+    lg2::debug("faultlog captured {COUNT} device tree targets", "COUNT",
+               _targets.size());
+}
+
+int DevTreeSnapshot::captureTarget(struct pdbg_target* target, void* priv)
+{
+    auto snapshot = reinterpret_cast<DevTreeSnapshot*>(priv);
+
+    ATTR_PHYS_DEV_PATH_Type phyPath;
+    if (DT_GET_PROP(ATTR_PHYS_DEV_PATH, target, phyPath))
+    {
+        return 0;
+    }
+
+    TargetInfo targetInfo;
+    targetInfo.target = target;
+    targetInfo.phyDevPath.assign(phyPath, strnlen(phyPath, sizeof(phyPath)));
+
+    ATTR_HWAS_STATE_Type hwasState;
+    if (!DT_GET_PROP(ATTR_HWAS_STATE, target, hwasState))
+    {
+        targetInfo.hwasState = hwasState;
+    }
+
+    // keep the first target if more than one target has the same path
+    if (snapshot->_targetsByPath
+            .emplace(targetInfo.phyDevPath, snapshot->_targets.size())
+            .second)
+    {
+        snapshot->_targets.push_back(std::move(targetInfo));
+    }
+    return 0;
+}
+
+const TargetInfo* DevTreeSnapshot::find(const std::string& phyDevPath) const
+{
+    auto it = _targetsByPath.find(phyDevPath);
+    if (it == _targetsByPath.end())
+    {
+        return nullptr;
+    }
+    return &_targets[it->second];
+}
+} // namespace openpower::faultlog
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <attributes_info.H>
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+extern "C"
+{
+#include <libpdbg.h>
+}
+
+namespace openpower::faultlog
+{
+/**
+ * @brief Device tree details of a pdbg target used by the faultlog sections
+ */
+struct TargetInfo
+{
+    pdbg_target* target = nullptr;
+    std::string phyDevPath;
+    std::optional<ATTR_HWAS_STATE_Type> hwasState;
+
+    /** @brief Get the location code of the target
+     *
+     *  @return location code, empty if not found
+     *
+     *  @note The location code is got on the first use since it is needed
+     *        only for the targets added in the faultlog.
+     */
+    const std::string& locationCode() const;
+
+  private:
+    /** @brief Location code of the target once got */
+    mutable std::optional<std::string> _locationCode;
+};
+
+/**
+ * @class DevTreeSnapshot
+ *
+ * Captures the physical path and HWAS state of all the pdbg targets by
+ * a single device tree traversal so that all the faultlog sections can use
+ * it instead of traversing the device tree on their own.
+ */
+class DevTreeSnapshot
+{
+  public:
+    DevTreeSnapshot(const DevTreeSnapshot&) = delete;
+    DevTreeSnapshot& operator=(const DevTreeSnapshot&) = delete;
+    DevTreeSnapshot(DevTreeSnapshot&&) = delete;
+    DevTreeSnapshot& operator=(DevTreeSnapshot&&) = delete;
+    ~DevTreeSnapshot() = default;
+
+    /** @brief Traverse the device tree and capture the targets details
+     *
+     *  @note The targets without the physical path are not captured
+     *        as those are of no use for the faultlog sections.
+     */
+    DevTreeSnapshot();
+
+    /** @brief Get the target details for the given physical path
+     *
+     *  @param[in] phyDevPath - physical path of the pdbg target
+     *
+     *  @return target details if found else nullptr
+     */
+    const TargetInfo* find(const std::string& phyDevPath) const;
+
+    /** @brief Get all the captured targets details
+     *
+     *  @return targets details in the device tree traversal order
+     */
+    const std::vector<TargetInfo>& targets() const
+    {
+        return _targets;
+    }
+
+  private:
+    /** @brief Captured targets details in the traversal order */
+    std::vector<TargetInfo> _targets;
+
+    /** @brief Index of the captured targets by the physical path */
+    std::unordered_map<std::string, std::size_t> _targetsByPath;
+
+    /** @brief pdbg_target_traverse callback to capture the target details
+     *
+     *  @param[in] target - pdbg target to capture
+     *  @param[inout] priv - the snapshot to update
+     *
+     *  @return 0 to continue the traversal till all the targets are parsed
+     */
+    static int captureTarget(struct pdbg_target* target, void* priv);
+};
+} // namespace openpower::faultlog
@@ -0,0 +1,219 @@
+#include <faultlog_binary_layout.hpp>
+#include <phosphor-logging/lg2.hpp>
+
+#include <array>
+#include <string_view>
+
+namespace openpower::faultlog
+{
+
+using ::nlohmann::json;
+
+/**
+ * @brief Get the positional fields of the given object
+ *
+ * @param[in] object - JSON object
+ * @param[in] keys - keys of the fields in the layout order
+ * @param[inout] fields - JSON array to append the fields
+ */
+template <std::size_t N>
+static void appendFields(const json& object,
+                         const std::array<std::string_view, N>& keys,
+                         json& fields)
+{
+    for (const auto& key : keys)
+    {
+        auto it = object.find(key);
+        fields.push_back(it != object.end() ? *it : json(nullptr));
+    }
+}
+
+/**
+ * @brief Get the positional fields of the given object
+ *
+ * @param[in] object - JSON object
+ * @param[in] keys - keys of the fields in the layout order
+ *
+ * @return JSON array of the fields
+ */
+template <std::size_t N>
+static json toFields(const json& object,
+                     const std::array<std::string_view, N>& keys)
+{
+    json fields = json::array();
+    appendFields(object, keys, fields);
+    return fields;
+}
+
+constexpr std::array<std::string_view, 5> calloutFields{
+    "Location Code", "Priority", "Part Number", "Serial Number", "CCIN"};
+constexpr std::array<std::string_view, 3> errorLogFields{"PLID", "SRC",
+                                                         "DATE_TIME"};
+constexpr std::array<std::string_view, 6> resourceActionFields{
+    "TYPE",         "CURRENT_STATE", "LOCATION_CODE", "REASON_DESCRIPTION",
+    "GUARD_RECORD", "PHYS_PATH"};
+
+/**
+ * @brief Get the positional layout of the CEC_ERROR_LOG section
+ *
+ * @param[in] cecErrorLog - CEC_ERROR_LOG JSON array which has the error log
+ *                          followed by the resource actions
+ *
+ * @return [errorLog, [resourceAction, ...]]
+ */
+static json toCecErrorLog(const json& cecErrorLog)
+{
+    json errorLog = nullptr;
+    json resourceActions = json::array();
+    for (const auto& elem : cecErrorLog)
+    {
+        auto resourceAction = elem.find("RESOURCE_ACTIONS");
+        if (resourceAction != elem.end())
+        {
+            // no resource action if the PEL is not having a guard record
+            resourceActions.push_back(
+                resourceAction->empty()
+                    ? json(nullptr)
+                    : toFields(*resourceAction, resourceActionFields));
+            continue;
+        }
+
+        errorLog = toFields(elem, errorLogFields);
+        json callouts = json::array();
+        auto calloutSection = elem.find("Callout Section");
+        if (calloutSection != elem.end())
+        {
+            auto calloutList = calloutSection->find("Callouts");
+            if (calloutList != calloutSection->end())
+            {
+                // single callout is added as object if the PEL is deleted
+                if (calloutList->is_object())
+                {
+                    callouts.push_back(toFields(*calloutList, calloutFields));
+                }
+                else
+                {
+                    for (const auto& callout : *calloutList)
+                    {
+                        callouts.push_back(toFields(callout, calloutFields));
+                    }
+                }
+            }
+        }
+        errorLog.push_back(std::move(callouts));
+    }
+    return json::array({std::move(errorLog), std::move(resourceActions)});
+}
+
+/**
+ * @brief Get the positional layout of the given faultlog section
+ *
+ * @param[in] name - section name
+ * @param[in] section - section JSON
+ *
+ * @return [sectionId, fields...] if known section else null
+ */
+static json toSection(const std::string& name, const json& section)
+{
+    auto sectionWithId = [](BinarySection id) {
+        return json::array({static_cast<uint32_t>(id)});
+    };
+
+    json fields;
+    if (name == "VERSION")
+    {
+        fields = sectionWithId(BinarySection::Version);
+        fields.push_back(section);
+    }
+    else if (name == "SYSTEM")
+    {
+        fields = sectionWithId(BinarySection::System);
+        appendFields(section,
+                     std::array<std::string_view, 2>{"SYSTEM_TYPE",
+                                                     "SYSTEM_SN"},
+                     fields);
+    }
+    else if (name == "POLICY")
+    {
+        fields = sectionWithId(BinarySection::Policy);
+        appendFields(section,
+                     std::array<std::string_view, 3>{"FCO_VALUE", "MASTER",
+                                                     "PREDICTIVE"},
+                     fields);
+    }
+    else if (name == "SERVICEABLE_EVENT")
+    {
+        fields = sectionWithId(BinarySection::ServiceableEvent);
+        json cecErrorLogs = json::array();
+        for (const auto& event : section)
+        {
+            auto cecErrorLog = event.find("CEC_ERROR_LOG");
+            if (cecErrorLog != event.end())
+            {
+                cecErrorLogs.push_back(toCecErrorLog(*cecErrorLog));
+            }
+        }
+        fields.push_back(std::move(cecErrorLogs));
+    }
+    else if (name == "MANUAL_ISOLATION")
+    {
+        fields = sectionWithId(BinarySection::ManualIsolation);
+        appendFields(section,
+                     std::array<std::string_view, 5>{
+                         "TYPE", "CURRENT_STATE", "PHYS_PATH",
+                         "REASON_DESCRIPTION", "LOCATION_CODE"},
+                     fields);
+    }
+    else if (name == "DECONFIGURED")
+    {
+        fields = sectionWithId(BinarySection::Deconfigured);
+        appendFields(section,
+                     std::array<std::string_view, 6>{
+                         "TYPE", "PLID", "CURRENT_STATE", "PHYS_PATH",
+                         "REASON_DESCRIPTION", "LOCATION_CODE"},
+                     fields);
+    }
+    else if ((name == "ADDED") || (name == "REMOVED"))
+    {
+        fields = sectionWithId((name == "ADDED") ? BinarySection::Added
+                                                 : BinarySection::Removed);
+        appendFields(section,
+                     std::array<std::string_view, 3>{"GUARD_RECORDS", "PELS",
+                                                     "DECONFIGURED"},
+                     fields);
+    }
+    return fields;
+}
+
+json FaultLogBinaryLayout::toPositional(const json& faultLogJson)
+{
+    json sections = json::array();
+    for (const auto& record : faultLogJson)
+    {
+        for (const auto& [name, section] : record.items())
+        {
+            json fields = toSection(name, section);
+            if (fields.is_null())
+            {
+                lg2::error("Skipping unknown faultlog section {SECTION} in "
+                           "binary format",
+                           "SECTION", name);
+                continue;
+            }
+            sections.push_back(std::move(fields));
+        }
+    }
+    return json::array({binaryLayoutVersion, std::move(sections)});
+}
+
+std::vector<uint8_t> FaultLogBinaryLayout::encode(const json& faultLogJson,
+                                                  const std::string& format)
+{
+    json positional = toPositional(faultLogJson);
+    if (format == "cbor")
+    {
+        return json::to_cbor(positional);
+    }
+    return json::to_msgpack(positional);
+}
+} // namespace openpower::faultlog
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace openpower::faultlog
+{
+/**
+ * @brief Version of the positional layout of the binary faultlog, must be
+ *        changed if any section or field position is changed
+ */
+constexpr uint32_t binaryLayoutVersion = 1;
+
+/**
+ * @brief Section id of the binary faultlog sections
+ */
+enum class BinarySection : uint32_t
+{
+    Version = 0,
+    System = 1,
+    Policy = 2,
+    ServiceableEvent = 3,
+    ManualIsolation = 4,
+    Deconfigured = 5,
+    Added = 6,
+    Removed = 7
+};
+
+/**
+ * @class FaultLogBinaryLayout
+ *
+ * Converts the faultlog JSON into the positional layout which is encoded
+ * in CBOR/MessagePack so that the consumers can decode the fields by
+ * their position instead of the string keys.
+ *
+ * Layout (the missing field is encoded as null):
+ *   faultlog        = [layoutVersion, [section, ...]]
+ *   section         = [sectionId, fields...] in the faultlog order
+ *   Version (0)     = [0, VERSION]
+ *   System (1)      = [1, SYSTEM_TYPE, SYSTEM_SN]
+ *   Policy (2)      = [2, FCO_VALUE, MASTER, PREDICTIVE]
+ *   ServiceableEvent (3) = [3, [cecErrorLog, ...]]
+ *     cecErrorLog   = [errorLog, [resourceAction, ...]]
+ *     errorLog      = [PLID, SRC, DATE_TIME, [callout, ...]]
+ *     callout       = [Location Code, Priority, Part Number,
+ *                      Serial Number, CCIN]
+ *     resourceAction = [TYPE, CURRENT_STATE, LOCATION_CODE,
+ *                       REASON_DESCRIPTION, GUARD_RECORD, PHYS_PATH]
+ *                      or null if no guard record for the PEL
+ *   ManualIsolation (4) = [4, TYPE, CURRENT_STATE, PHYS_PATH,
+ *                          REASON_DESCRIPTION, LOCATION_CODE]
+ *   Deconfigured (5) = [5, TYPE, PLID, CURRENT_STATE, PHYS_PATH,
+ *                       REASON_DESCRIPTION, LOCATION_CODE]
+ *   Added (6), Removed (7) = [id, GUARD_RECORDS, PELS, DECONFIGURED]
+ */
+class FaultLogBinaryLayout
+{
+  private:
+    FaultLogBinaryLayout() = delete;
+    FaultLogBinaryLayout(const FaultLogBinaryLayout&) = delete;
+    FaultLogBinaryLayout& operator=(const FaultLogBinaryLayout&) = delete;
+    FaultLogBinaryLayout(FaultLogBinaryLayout&&) = delete;
+    FaultLogBinaryLayout& operator=(FaultLogBinaryLayout&&) = delete;
+    ~FaultLogBinaryLayout() = delete;
+
+  public:
+    /** @brief Encode the faultlog JSON in the positional layout
+     *
+     *  @param[in] faultLogJson - faultlog JSON array
+     *  @param[in] format - cbor or msgpack
+     *
+     *  @return encoded faultlog
+     */
+    static std::vector<uint8_t> encode(const nlohmann::json& faultLogJson,
+                                       const std::string& format);
+
+    /** @brief Convert the faultlog JSON into the positional layout
+     *
+     *  @param[in] faultLogJson - faultlog JSON array
+     *
+     *  @return faultlog in the positional layout
+     *
+     *  @note The unknown sections are skipped.
+     */
+    static nlohmann::json toPositional(const nlohmann::json& faultLogJson);
+};
+} // namespace openpower::faultlog
@@ -0,0 +1,56 @@
+#include "config.h"
+
+#include <faultlog_client.hpp>
+#include <faultlog_daemon.hpp>
+#include <phosphor-logging/lg2.hpp>
+
+#include <string>
+
+namespace openpower::faultlog
+{
+
+using ::nlohmann::json;
+
+bool FaultLogClient::isDaemonRunning(sdbusplus::bus::bus& bus)
+{
+    try
+    {
+        auto method = bus.new_method_call(
+            "org.freedesktop.DBus", "/org/freedesktop/DBus",
+            "org.freedesktop.DBus", "NameHasOwner");
+        method.append(FAULTLOG_BUSNAME);
+        auto reply = bus.call(method);
+        bool hasOwner = false;
+        reply.read(hasOwner);
+        return hasOwner;
+    }
+    catch (const sdbusplus::exception::SdBusError& ex)
+    {
+        lg2::info("Failed to check the faultlog daemon {ERROR}", "ERROR", ex);
+    }
+    return false;
+}
+
+json FaultLogClient::getReport(sdbusplus::bus::bus& bus)
+{
+    auto method = bus.new_method_call(FAULTLOG_BUSNAME, FAULTLOG_OBJPATH,
+                                      faultLogDaemonIface, "GetReport");
+    auto reply = bus.call(method);
+    std::string report;
+    reply.read(report);
+    return json::parse(report);
+}
+
+NagCounts FaultLogClient::getNagCounts(sdbusplus::bus::bus& bus,
+                                       bool ignorePwrFanPel)
+{
+    auto method = bus.new_method_call(FAULTLOG_BUSNAME, FAULTLOG_OBJPATH,
+                                      faultLogDaemonIface, "GetNagCounts");
+    method.append(ignorePwrFanPel);
+    auto reply = bus.call(method);
+    NagCounts counts;
+    reply.read(counts.guardCount, counts.manualGuardCount,
+               counts.deconfigCount, counts.unresolvedPelsCount);
+    return counts;
+}
+} // namespace openpower::faultlog
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <faultlog_report.hpp>
+#include <nlohmann/json.hpp>
+#include <sdbusplus/bus.hpp>
+
+namespace openpower::faultlog
+{
+/**
+ * @class FaultLogClient
+ *
+ * Gets the faultlog and the faultlog pel (NAG) counts from the faultlog
+ * daemon instead of reading the device tree, guard records and logging
+ * entries again.
+ */
+class FaultLogClient
+{
+  private:
+    FaultLogClient() = delete;
+    FaultLogClient(const FaultLogClient&) = delete;
+    FaultLogClient& operator=(const FaultLogClient&) = delete;
+    FaultLogClient(FaultLogClient&&) = delete;
+    FaultLogClient& operator=(FaultLogClient&&) = delete;
+    ~FaultLogClient() = delete;
+
+  public:
+    /** @brief Check whether the faultlog daemon is running
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *
+     *  @return true if running else false
+     */
+    static bool isDaemonRunning(sdbusplus::bus::bus& bus);
+
+    /** @brief Get the faultlog sections from the faultlog daemon
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *
+     *  @return faultlog sections JSON array without the VERSION and the
+     *          SYSTEM header
+     */
+    static nlohmann::json getReport(sdbusplus::bus::bus& bus);
+
+    /** @brief Get count of the records to create the faultlog pel from the
+     *         faultlog daemon
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *  @param[in] ignorePwrFanPel - true - ignore pwr/fan pels
+     *
+     *  @return records count
+     */
+    static NagCounts getNagCounts(sdbusplus::bus::bus& bus,
+                                  bool ignorePwrFanPel);
+};
+} // namespace openpower::faultlog
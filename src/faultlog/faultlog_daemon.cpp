@@ -0,0 +1,237 @@
+#include "config.h"
+
+#include <sys/epoll.h>
+#include <sys/stat.h>
+
+#include <faultlog_daemon.hpp>
+#include <libguard/guard_interface.hpp>
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+namespace openpower::faultlog
+{
+
+using ::nlohmann::json;
+
+constexpr auto loggingObjPath = "/xyz/openbmc_project/logging";
+constexpr auto loggingEntryIface = "xyz.openbmc_project.Logging.Entry";
+
+const sdbusplus::vtable::vtable_t FaultLogDaemon::_vtable[] = {
+    sdbusplus::vtable::start(),
+    sdbusplus::vtable::method("GetReport", "", "s",
+                              FaultLogDaemon::callbackGetReport),
+    sdbusplus::vtable::method("GetNagCounts", "b", "iiii",
+                              FaultLogDaemon::callbackGetNagCounts),
+    sdbusplus::vtable::end()};
+
+FaultLogDaemon::FaultLogDaemon(sdbusplus::bus::bus& bus,
+                               const sdeventplus::Event& event) :
+    _bus(bus), _event(event), _guardRecords(FaultLogReport::getGuardRecords()),
+    _devTreeIdentity(getDevTreeIdentity()),
+    _guardFileWatch(
+        event.get(), IN_NONBLOCK, IN_CLOSE_WRITE, EPOLLIN,
+        openpower::guard::getGuardFilePath(),
+        std::bind(std::mem_fn(&FaultLogDaemon::reloadGuardRecords), this)),
+    _interface(bus, FAULTLOG_OBJPATH, faultLogDaemonIface, _vtable, this)
+{
+    namespace sdbusplus_match = sdbusplus::bus::match;
+
+    // Watch the logging entries before reading them so that the entries
+    // changed while reading are also captured.
+    _watchers.push_back(std::make_unique<sdbusplus_match::match>(
+        _bus, sdbusplus_match::rules::interfacesAdded(loggingObjPath),
+        [this](sdbusplus::message::message& msg) {
+        try
+        {
+            sdbusplus::message::object_path path;
+            LoggingSnapshot::Interfaces interfaces;
+            msg.read(path, interfaces);
+            _logging->addEntry(path.str, interfaces);
+        }
+        catch (const sdbusplus::exception::SdBusError& ex)
+        {
+            lg2::error("Failed to read the added logging entry {ERROR}",
+                       "ERROR", ex);
+        }
+    }));
+
+    _watchers.push_back(std::make_unique<sdbusplus_match::match>(
+        _bus, sdbusplus_match::rules::interfacesRemoved(loggingObjPath),
+        [this](sdbusplus::message::message& msg) {
+        try
+        {
+            sdbusplus::message::object_path path;
+            std::vector<std::string> interfaces;
+            msg.read(path, interfaces);
+            if (std::find(interfaces.begin(), interfaces.end(),
+                          loggingEntryIface) != interfaces.end())
+            {
+                _logging->removeEntry(path.str);
+            }
+        }
+        catch (const sdbusplus::exception::SdBusError& ex)
+        {
+            lg2::error("Failed to read the removed logging entry {ERROR}",
+                       "ERROR", ex);
+        }
+    }));
+
+    _watchers.push_back(std::make_unique<sdbusplus_match::match>(
+        _bus,
+        sdbusplus_match::rules::type::signal() +
+            sdbusplus_match::rules::member("PropertiesChanged") +
+            sdbusplus_match::rules::interface(
+                "org.freedesktop.DBus.Properties") +
+            sdbusplus_match::rules::path_namespace(loggingObjPath),
+        [this](sdbusplus::message::message& msg) {
+        try
+        {
+            std::string intf;
+            LoggingSnapshot::Properties properties;
+            msg.read(intf, properties);
+            _logging->updateEntry(msg.get_path(), intf, properties);
+        }
+        catch (const sdbusplus::exception::SdBusError& ex)
+        {
+            lg2::error("Failed to read the changed logging entry {ERROR}",
+                       "ERROR", ex);
+        }
+    }));
+
+    // The targets state is changed by the host during the boot.
+    _watchers.push_back(std::make_unique<sdbusplus_match::match>(
+        _bus,
+        sdbusplus_match::rules::propertiesChanged(
+            "/xyz/openbmc_project/state/host0",
+            "xyz.openbmc_project.State.Boot.Progress"),
+        [this](sdbusplus::message::message&) { _devTreeStale = true; }));
+
+    _logging.emplace(_bus);
+
+    lg2::info("faultlog daemon captured {GUARD_COUNT} guard records and "
+              "{LOG_COUNT} logging entries",
+              "GUARD_COUNT", _guardRecords.size(), "LOG_COUNT",
+              _logging->entries().size());
+}
+
+void FaultLogDaemon::reloadGuardRecords()
+{
+    try
+    {
+        _guardRecords = FaultLogReport::getGuardRecords();
+    }
+    catch (const std::exception& ex)
+    {
+        lg2::error("Failed to reload the guard records {ERROR}", "ERROR", ex);
+    }
+
+    // The guarded targets might be deconfigured.
+    _devTreeStale = true;
+}
+
+FaultLogDaemon::DevTreeIdentity FaultLogDaemon::getDevTreeIdentity()
+{
+    DevTreeIdentity identity;
+    struct stat devTreeStat;
+    if (stat(PHAL_DEVTREE, &devTreeStat) == 0)
+    {
+        identity.dev = devTreeStat.st_dev;
+        identity.ino = devTreeStat.st_ino;
+        identity.writeTime = devTreeStat.st_mtim;
+    }
+    return identity;
+}
+
+const DevTreeSnapshot& FaultLogDaemon::getDevTree()
+{
+    // The targets can be captured again only from the device tree which
+    // is loaded while initializing PHAL so, restart to load the changed
+    // device tree.
+    if (getDevTreeIdentity() != _devTreeIdentity)
+    {
+        lg2::info("Device tree is changed, exiting the faultlog daemon to "
+                  "restart");
+        _event.exit(EXIT_SUCCESS);
+        throw std::runtime_error("Device tree is changed, faultlog daemon is "
+                                 "restarting");
+    }
+
+    if (_devTreeStale || !_devTree.has_value())
+    {
+        _devTree.emplace();
+        _devTreeStale = false;
+    }
+    return *_devTree;
+}
+
+json FaultLogDaemon::getReport()
+{
+    json records = json::array();
+    FaultLogReport::populate(_bus, _guardRecords, getDevTree(), *_logging,
+                             records, nullptr);
+    return records;
+}
+
+NagCounts FaultLogDaemon::getNagCounts(bool ignorePwrFanPel)
+{
+    return FaultLogReport::getNagCounts(_bus, _guardRecords, getDevTree(),
+                                        *_logging, ignorePwrFanPel);
+}
+
+int FaultLogDaemon::callbackGetReport(sd_bus_message* msg, void* context,
+                                      sd_bus_error* error)
+{
+    auto daemon = static_cast<FaultLogDaemon*>(context);
+    try
+    {
+        sdbusplus::message::message method(msg);
+        auto reply = method.new_method_return();
+        reply.append(daemon->getReport().dump());
+        reply.method_return();
+    }
+    catch (const sdbusplus::exception::SdBusError& ex)
+    {
+        return sd_bus_error_set(error, ex.name(), ex.description());
+    }
+    catch (const std::exception& ex)
+    {
+        lg2::error("Failed to get the faultlog {ERROR}", "ERROR", ex);
+        return sd_bus_error_set(error, SD_BUS_ERROR_FAILED, ex.what());
+    }
+    return 1;
+}
+
+int FaultLogDaemon::callbackGetNagCounts(sd_bus_message* msg, void* context,
+                                         sd_bus_error* error)
+{
+    auto daemon = static_cast<FaultLogDaemon*>(context);
+    try
+    {
+        sdbusplus::message::message method(msg);
+        bool ignorePwrFanPel = false;
+        method.read(ignorePwrFanPel);
+
+        auto counts = daemon->getNagCounts(ignorePwrFanPel);
+        auto reply = method.new_method_return();
+        reply.append(counts.guardCount, counts.manualGuardCount,
+                     counts.deconfigCount, counts.unresolvedPelsCount);
+        reply.method_return();
+    }
+    catch (const sdbusplus::exception::SdBusError& ex)
+    {
+        return sd_bus_error_set(error, ex.name(), ex.description());
+    }
+    catch (const std::exception& ex)
+    {
+        lg2::error("Failed to get the faultlog pel counts {ERROR}", "ERROR",
+                   ex);
+        return sd_bus_error_set(error, SD_BUS_ERROR_FAILED, ex.what());
+    }
+    return 1;
+}
+} // namespace openpower::faultlog
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <sys/types.h>
+#include <systemd/sd-bus.h>
+
+#include <common/watch.hpp>
+#include <devtree_snapshot.hpp>
+#include <faultlog_report.hpp>
+#include <logging_snapshot.hpp>
+#include <nlohmann/json.hpp>
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/bus/match.hpp>
+#include <sdbusplus/server/interface.hpp>
+#include <sdbusplus/vtable.hpp>
+#include <sdeventplus/event.hpp>
+
+#include <ctime>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace openpower::faultlog
+{
+constexpr auto faultLogDaemonIface = "org.open_power.Faultlog";
+
+/**
+ * @class FaultLogDaemon
+ *
+ * Keeps the device tree targets, guard records and logging entries in
+ * memory and serves the faultlog and the faultlog pel (NAG) counts over
+ * D-Bus so that the faultlog tool need not to read them on every run.
+ *
+ * The guard records are reloaded on the guard file change, the logging
+ * entries are updated from the logging signals and the device tree
+ * targets are captured again from the loaded device tree on the next
+ * request once the guard file or the host boot progress is changed.
+ *
+ * PHAL is initialized only once in the process so, the daemon exits to
+ * be restarted by systemd (and the request is failed to make the client
+ * collect locally) once the device tree file is changed.
+ */
+class FaultLogDaemon
+{
+  public:
+    FaultLogDaemon() = delete;
+    FaultLogDaemon(const FaultLogDaemon&) = delete;
+    FaultLogDaemon& operator=(const FaultLogDaemon&) = delete;
+    FaultLogDaemon(FaultLogDaemon&&) = delete;
+    FaultLogDaemon& operator=(FaultLogDaemon&&) = delete;
+    ~FaultLogDaemon() = default;
+
+    /** @brief Constructor to serve the faultlog over D-Bus
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *  @param[in] event - sd_event handler to watch the guard file
+     *
+     *  @note PHAL and libguard should be initialized before.
+     */
+    FaultLogDaemon(sdbusplus::bus::bus& bus, const sdeventplus::Event& event);
+
+  private:
+    /** @brief The device tree file identity to find the file change */
+    struct DevTreeIdentity
+    {
+        dev_t dev = 0;
+        ino_t ino = 0;
+        timespec writeTime = {};
+
+        bool operator==(const DevTreeIdentity& other) const
+        {
+            return (dev == other.dev) && (ino == other.ino) &&
+                   (writeTime.tv_sec == other.writeTime.tv_sec) &&
+                   (writeTime.tv_nsec == other.writeTime.tv_nsec);
+        }
+    };
+
+    /** @brief Attached bus connection */
+    sdbusplus::bus::bus& _bus;
+
+    /** @brief sd_event handler to exit on the device tree change */
+    sdeventplus::Event _event;
+
+    /** @brief Unresolved guard records */
+    GuardRecords _guardRecords;
+
+    /** @brief Device tree targets details, captured on request */
+    std::optional<DevTreeSnapshot> _devTree;
+
+    /** @brief true if the device tree targets should be captured again */
+    bool _devTreeStale = true;
+
+    /** @brief Device tree file identity which is loaded by PHAL */
+    DevTreeIdentity _devTreeIdentity;
+
+    /** @brief Logging entries details, updated from the logging signals */
+    std::optional<LoggingSnapshot> _logging;
+
+    /** @brief Watch the guard file to reload the guard records */
+    hw_isolation::watch::inotify::Watch _guardFileWatch;
+
+    /** @brief Watch the logging entries and the host boot progress */
+    std::vector<std::unique_ptr<sdbusplus::bus::match::match>> _watchers;
+
+    /** @brief Faultlog D-Bus interface */
+    sdbusplus::server::interface_t _interface;
+
+    /** @brief Faultlog D-Bus interface methods */
+    static const sdbusplus::vtable::vtable_t _vtable[];
+
+    /** @brief Reload the guard records on the guard file change
+     *
+     *  @return NULL
+     */
+    void reloadGuardRecords();
+
+    /** @brief Get the device tree file identity
+     *
+     *  @return device tree file identity, default if failed to get
+     */
+    static DevTreeIdentity getDevTreeIdentity();
+
+    /** @brief Get the device tree targets details
+     *
+     *  @return device tree targets details, captured again if stale
+     *
+     *  @note Throws exception and exits the event loop if the device tree
+     *        file is changed after PHAL is initialized.
+     */
+    const DevTreeSnapshot& getDevTree();
+
+    /** @brief Get the faultlog sections
+     *
+     *  @return faultlog sections JSON array without the VERSION and the
+     *          SYSTEM header
+     */
+    nlohmann::json getReport();
+
+    /** @brief Get count of the records to create the faultlog pel
+     *
+     *  @param[in] ignorePwrFanPel - true - ignore pwr/fan pels
+     *
+     *  @return records count
+     */
+    NagCounts getNagCounts(bool ignorePwrFanPel);
+
+    /** @brief D-Bus method GetReport callback
+     *
+     *  @param[in] msg - method call message
+     *  @param[in] context - faultlog daemon object
+     *  @param[out] error - error to return on failure
+     *
+     *  @return 1 on success else negative errno
+     */
+    static int callbackGetReport(sd_bus_message* msg, void* context,
+                                 sd_bus_error* error);
+
+    /** @brief D-Bus method GetNagCounts callback
+     *
+     *  @param[in] msg - method call message
+     *  @param[in] context - faultlog daemon object
+     *  @param[out] error - error to return on failure
+     *
+     *  @return 1 on success else negative errno
+     */
+    static int callbackGetNagCounts(sd_bus_message* msg, void* context,
+                                    sd_bus_error* error);
+};
+} // namespace openpower::faultlog
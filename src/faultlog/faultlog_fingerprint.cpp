@@ -0,0 +1,260 @@
+#include "config.h"
+
+#include <deconfig_records.hpp>
+#include <faultlog_fingerprint.hpp>
+#include <phosphor-logging/lg2.hpp>
+#include <poweron_time.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+namespace openpower::faultlog
+{
+
+using ::nlohmann::json;
+
+/**
+ * @brief Get the last write time of the given file
+ *
+ * @param[in] path - file path
+ *
+ * @return last write time if found else 0
+ */
+static int64_t getWriteTime(const std::string& path)
+{
+    std::error_code ec;
+    auto writeTime = std::filesystem::last_write_time(path, ec);
+    if (ec)
+    {
+        return 0;
+    }
+    return writeTime.time_since_epoch().count();
+}
+
+/**
+ * @brief Get the hash of the guard record
+ *
+ * @param[in] record - guard record
+ *
+ * @return FNV-1a hash of the guard record in hex
+ *
+ * @note The hash should not be changed across the faultlog versions since
+ *       it is persisted so, std::hash is not used.
+ */
+static std::string
+    getGuardRecordHash(const openpower::guard::GuardRecord& record)
+{
+    constexpr uint64_t fnvOffsetBasis = 0xcbf29ce484222325;
+    constexpr uint64_t fnvPrime = 0x100000001b3;
+
+    auto hash = fnvOffsetBasis;
+    auto hashBytes = [&hash](const void* data, std::size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= fnvPrime;
+        }
+    };
+    hashBytes(&record.targetId, sizeof(record.targetId));
+    hashBytes(&record.elogId, sizeof(record.elogId));
+    hashBytes(&record.errType, sizeof(record.errType));
+
+    std::stringstream ss;
+    ss << std::hex << hash;
+    return ss.str();
+}
+
+/**
+ * @brief Get the platform log id in hex as in the faultlog
+ *
+ * @param[in] plid - platform log id
+ *
+ * @return platform log id in hex
+ */
+static std::string plidToStr(uint32_t plid)
+{
+    std::stringstream ss;
+    ss << std::hex << "0x" << plid;
+    return ss.str();
+}
+
+Fingerprint FaultLogFingerprint::capture(const GuardRecords& guardRecords,
+                                         const LoggingSnapshot& logging,
+                                         bool ignorePwrFanPel)
+{
+    Fingerprint fingerprint;
+    fingerprint.ignorePwrFanPel = ignorePwrFanPel;
+    fingerprint.devTreeWriteTime = getWriteTime(PHAL_DEVTREE);
+    fingerprint.poweronTimeWriteTime = getWriteTime(poweronTimeFile);
+
+    for (const auto& elem : guardRecords)
+    {
+        fingerprint.guardRecords.emplace(elem.recordId,
+                                         getGuardRecordHash(elem));
+    }
+
+    for (const auto& entry : logging.entries())
+    {
+        if (entry.resolved || (!entry.deconfigured && !entry.guarded))
+        {
+            continue;
+        }
+        fingerprint.pels.emplace(entry.plid);
+    }
+    return fingerprint;
+}
+
+void FaultLogFingerprint::captureDeconfigured(const GuardRecords& guardRecords,
+                                              const DevTreeSnapshot& devTree,
+                                              Fingerprint& fingerprint)
+{
+    fingerprint.deconfiguredTargets.clear();
+    for (const auto* targetInfo :
+         DeconfigRecords::getDeconfigList(guardRecords, devTree))
+    {
+        fingerprint.deconfiguredTargets.emplace(targetInfo->phyDevPath);
+    }
+}
+
+bool FaultLogFingerprint::isSame(const Fingerprint& current,
+                                 const Fingerprint& previous)
+{
+    return (current.ignorePwrFanPel == previous.ignorePwrFanPel) &&
+           (current.devTreeWriteTime == previous.devTreeWriteTime) &&
+           (current.poweronTimeWriteTime == previous.poweronTimeWriteTime) &&
+           (current.guardRecords == previous.guardRecords) &&
+           (current.pels == previous.pels);
+}
+
+json FaultLogFingerprint::diff(const Fingerprint& previous,
+                               const Fingerprint& current)
+{
+    // guard record is considered removed and added again if it is changed
+    auto guardRecordsDiff = [](const Fingerprint& from, const Fingerprint& to) {
+        json records = json::array();
+        for (const auto& [recordId, hash] : to.guardRecords)
+        {
+            auto it = from.guardRecords.find(recordId);
+            if ((it == from.guardRecords.end()) || (it->second != hash))
+            {
+                records.push_back(recordId);
+            }
+        }
+        return records;
+    };
+
+    auto pelsDiff = [](const Fingerprint& from, const Fingerprint& to) {
+        json pels = json::array();
+        for (const auto& plid : to.pels)
+        {
+            if (!from.pels.contains(plid))
+            {
+                pels.push_back(plidToStr(plid));
+            }
+        }
+        return pels;
+    };
+
+    auto deconfiguredDiff = [](const Fingerprint& from,
+                               const Fingerprint& to) {
+        json targets = json::array();
+        std::set_difference(to.deconfiguredTargets.begin(),
+                            to.deconfiguredTargets.end(),
+                            from.deconfiguredTargets.begin(),
+                            from.deconfiguredTargets.end(),
+                            std::back_inserter(targets));
+        return targets;
+    };
+
+    json added = json::object();
+    added["GUARD_RECORDS"] = guardRecordsDiff(previous, current);
+    added["PELS"] = pelsDiff(previous, current);
+    added["DECONFIGURED"] = deconfiguredDiff(previous, current);
+
+    json removed = json::object();
+    removed["GUARD_RECORDS"] = guardRecordsDiff(current, previous);
+    removed["PELS"] = pelsDiff(current, previous);
+    removed["DECONFIGURED"] = deconfiguredDiff(current, previous);
+
+    json jsonDiff = json::array();
+    jsonDiff.push_back(json{{"ADDED", std::move(added)}});
+    jsonDiff.push_back(json{{"REMOVED", std::move(removed)}});
+    return jsonDiff;
+}
+
+std::optional<Fingerprint> FaultLogFingerprint::load(const std::string& path)
+{
+    if (!std::filesystem::exists(path))
+    {
+        return std::nullopt;
+    }
+
+    try
+    {
+        std::ifstream file(path);
+        json jsonFingerprint = json::parse(file);
+
+        Fingerprint fingerprint;
+        fingerprint.ignorePwrFanPel =
+            jsonFingerprint.at("IGNORE_PWR_FAN_PEL").get<bool>();
+        fingerprint.devTreeWriteTime =
+            jsonFingerprint.at("DEVTREE_WRITE_TIME").get<int64_t>();
+        fingerprint.poweronTimeWriteTime =
+            jsonFingerprint.at("POWERON_TIME_WRITE_TIME").get<int64_t>();
+        for (const auto& [recordId, hash] :
+             jsonFingerprint.at("GUARD_RECORDS").items())
+        {
+            fingerprint.guardRecords.emplace(std::stoul(recordId),
+                                             hash.get<std::string>());
+        }
+        fingerprint.pels =
+            jsonFingerprint.at("PELS").get<std::set<uint32_t>>();
+        fingerprint.deconfiguredTargets =
+            jsonFingerprint.at("DECONFIGURED").get<std::set<std::string>>();
+        return fingerprint;
+    }
+    catch (const std::exception& ex)
+    {
+        lg2::error("Failed to read faultlog fingerprint from file {FILE} "
+                   "{ERROR}",
+                   "FILE", path, "ERROR", ex);
+    }
+    return std::nullopt;
+}
+
+void FaultLogFingerprint::save(const std::string& path,
+                               const Fingerprint& fingerprint)
+{
+    try
+    {
+        json jsonFingerprint = json::object();
+        jsonFingerprint["IGNORE_PWR_FAN_PEL"] = fingerprint.ignorePwrFanPel;
+        jsonFingerprint["DEVTREE_WRITE_TIME"] = fingerprint.devTreeWriteTime;
+        jsonFingerprint["POWERON_TIME_WRITE_TIME"] =
+            fingerprint.poweronTimeWriteTime;
+        json guardRecords = json::object();
+        for (const auto& [recordId, hash] : fingerprint.guardRecords)
+        {
+            guardRecords[std::to_string(recordId)] = hash;
+        }
+        jsonFingerprint["GUARD_RECORDS"] = std::move(guardRecords);
+        jsonFingerprint["PELS"] = fingerprint.pels;
+        jsonFingerprint["DECONFIGURED"] = fingerprint.deconfiguredTargets;
+
+        std::ofstream file(path);
+        file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+        file << jsonFingerprint.dump();
+        file.close();
+    }
+    catch (const std::exception& ex)
+    {
+        lg2::error("Failed to write faultlog fingerprint to file {FILE} "
+                   "{ERROR}",
+                   "FILE", path, "ERROR", ex);
+    }
+}
+} // namespace openpower::faultlog
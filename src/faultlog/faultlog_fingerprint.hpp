@@ -0,0 +1,123 @@
+#pragma once
+
+#include <devtree_snapshot.hpp>
+#include <libguard/include/guard_record.hpp>
+#include <logging_snapshot.hpp>
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+
+namespace openpower::faultlog
+{
+using ::openpower::guard::GuardRecords;
+
+constexpr auto reportFingerprintFile =
+    "/var/lib/op-hw-isolation/persistdata/faultlog_report_fingerprint";
+constexpr auto nagFingerprintFile =
+    "/var/lib/op-hw-isolation/persistdata/faultlog_nag_fingerprint";
+
+/**
+ * @brief Compact fingerprint of the faultlog inputs
+ */
+struct Fingerprint
+{
+    bool ignorePwrFanPel = false;
+
+    // last write time of the device tree and the chassis poweron time file
+    int64_t devTreeWriteTime = 0;
+    int64_t poweronTimeWriteTime = 0;
+
+    // guard record id and the hash of the guard record
+    std::map<uint32_t, std::string> guardRecords;
+
+    // platform log id of the unresolved deconfig/guard PELs
+    std::set<uint32_t> pels;
+
+    // physical path of the deconfigured targets, captured only if the
+    // other fingerprint fields are changed
+    std::set<std::string> deconfiguredTargets;
+};
+
+/**
+ * @class FaultLogFingerprint
+ *
+ * Captures and persists the fingerprint of the faultlog inputs to find
+ * the changes since the previous faultlog run without the device tree
+ * traversal.
+ */
+class FaultLogFingerprint
+{
+  private:
+    FaultLogFingerprint() = delete;
+    FaultLogFingerprint(const FaultLogFingerprint&) = delete;
+    FaultLogFingerprint& operator=(const FaultLogFingerprint&) = delete;
+    FaultLogFingerprint(FaultLogFingerprint&&) = delete;
+    FaultLogFingerprint& operator=(FaultLogFingerprint&&) = delete;
+    ~FaultLogFingerprint() = delete;
+
+  public:
+    /** @brief Capture the fingerprint except the deconfigured targets
+     *
+     *  @param[in] guardRecords - Guard records
+     *  @param[in] logging - logging entries details
+     *  @param[in] ignorePwrFanPel - true - ignore pwr/fan pels
+     *
+     *  @return fingerprint
+     */
+    static Fingerprint capture(const GuardRecords& guardRecords,
+                               const LoggingSnapshot& logging,
+                               bool ignorePwrFanPel);
+
+    /** @brief Capture the deconfigured targets in the fingerprint
+     *
+     *  @param[in] guardRecords - Guard records
+     *  @param[in] devTree - device tree targets details
+     *  @param[inout] fingerprint - fingerprint to update
+     */
+    static void captureDeconfigured(const GuardRecords& guardRecords,
+                                    const DevTreeSnapshot& devTree,
+                                    Fingerprint& fingerprint);
+
+    /** @brief Check whether the faultlog inputs are same
+     *
+     *  @param[in] current - fingerprint of the current run
+     *  @param[in] previous - fingerprint of the previous run
+     *
+     *  @return true if same else false
+     *
+     *  @note The deconfigured targets are not compared since those are
+     *        changed only along with the device tree.
+     */
+    static bool isSame(const Fingerprint& current,
+                       const Fingerprint& previous);
+
+    /** @brief Get the added and removed items since the previous run
+     *
+     *  @param[in] previous - fingerprint of the previous run
+     *  @param[in] current - fingerprint of the current run
+     *
+     *  @return JSON array having ADDED and REMOVED sections
+     */
+    static nlohmann::json diff(const Fingerprint& previous,
+                               const Fingerprint& current);
+
+    /** @brief Read the fingerprint from the given file
+     *
+     *  @param[in] path - fingerprint file
+     *
+     *  @return fingerprint if found else empty optional
+     */
+    static std::optional<Fingerprint> load(const std::string& path);
+
+    /** @brief Write the fingerprint to the given file
+     *
+     *  @param[in] path - fingerprint file
+     *  @param[in] fingerprint - fingerprint to write
+     */
+    static void save(const std::string& path, const Fingerprint& fingerprint);
+};
+} // namespace openpower::faultlog
@@ -4,21 +4,31 @@
 
 #include <CLI/CLI.hpp>
 #include <deconfig_records.hpp>
+#include <devtree_snapshot.hpp>
+#include <faultlog_binary_layout.hpp>
+#include <faultlog_client.hpp>
+#include <faultlog_daemon.hpp>
+#include <faultlog_fingerprint.hpp>
 #include <faultlog_policy.hpp>
+#include <faultlog_report.hpp>
 #include <guard_with_eid_records.hpp>
 #include <guard_without_eid_records.hpp>
+#include <json_stream_writer.hpp>
 #include <libguard/guard_interface.hpp>
 #include <libguard/include/guard_record.hpp>
+#include <logging_snapshot.hpp>
 #include <nlohmann/json.hpp>
 #include <phosphor-logging/lg2.hpp>
 #include <sdbusplus/bus.hpp>
 #include <sdeventplus/clock.hpp>
 #include <sdeventplus/source/event.hpp>
 #include <sdeventplus/utility/timer.hpp>
+#include <unistd.h>
 #include <unresolved_pels.hpp>
 #include <util.hpp>
 
 #include <iostream>
+#include <optional>
 #include <unordered_set>
 #include <vector>
 extern "C"
@@ -31,13 +41,13 @@ using ::nlohmann::json;
 using ::openpower::guard::GuardRecords;
 using Timer = sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic>;
 
-#define GUARD_RESOLVED 0xFFFFFFFF
 constexpr float FAULTLOG_FORMAT_VERSION = 1.0;
 using Severity = sdbusplus::xyz::openbmc_project::Logging::server::Entry::Level;
 
 using Binary = std::vector<uint8_t>;
 
 constexpr std::chrono::milliseconds hostStateCheckTimeout(5000); // 5sec
+constexpr std::chrono::seconds pelCreateTimeout(10);               // 10sec
 constexpr auto IGNORE_PWR_FAN_PEL = true;
 
 /**
@@ -70,49 +80,71 @@ void initPHAL()
     }
 }
 
-/** @brief Helper method to create faultlog pel
+/** @brief Helper method to get count of the records to create faultlog pel
  *
  *  @param[in] bus - D-Bus to attach to
- *  @param[in] guardRecords - hardware isolated records to parse
+ *  @param[in] unresolvedRecords - hardware isolated records to parse
  *  @param[in] ignorePwrFanPel - true - ignore pwr/fan pels
+ *
+ *  @return records count
  */
-void createNagPel(sdbusplus::bus::bus& bus,
-                  const GuardRecords& unresolvedRecords, bool ignorePwrFanPel)
+NagCounts getNagCounts(sdbusplus::bus::bus& bus,
+                       const GuardRecords& unresolvedRecords,
+                       bool ignorePwrFanPel)
+{
+    // single device tree traversal and logging entries read for all
+    // the records count
+    DevTreeSnapshot devTree;
+    LoggingSnapshot logging(bus);
+    return FaultLogReport::getNagCounts(bus, unresolvedRecords, devTree,
+                                        logging, ignorePwrFanPel);
+}
+
+/** @brief Helper method to create faultlog pel
+ *
+ *  @param[in] bus - D-Bus to attach to
+ *  @param[in] counts - count of the records to create faultlog pel
+ *
+ *  @return true if the pel is created or not required else false
+ */
+bool createNagPel(sdbusplus::bus::bus& bus, const NagCounts& counts)
 {
-    //
-    // serviceable records count
-    int guardCount = GuardWithEidRecords::getCount(bus, unresolvedRecords);
-    int unresolvedPelsCount = UnresolvedPELs::getCount(bus, ignorePwrFanPel);
-
-    //
-    // deconfigured records count
-    int manualGuardCount = GuardWithoutEidRecords::getCount(unresolvedRecords);
-    int deconfigCount = DeconfigRecords::getCount(unresolvedRecords);
     lg2::info(
         "faultlog GUARD_COUNT: {GUARD_COUNT}, MAN_GUARD_COUNT: "
         "{MAN_GUARD_COUNT}, "
         "DECONFIG_REC_COUNT: {DECONFIG_REC_COUNT} , PEL_COUNT: {PEL_COUNT} ",
-        "GUARD_COUNT", guardCount, "MAN_GUARD_COUNT", manualGuardCount,
-        "DECONFIG_REC_COUNT", deconfigCount, "PEL_COUNT", unresolvedPelsCount);
+        "GUARD_COUNT", counts.guardCount, "MAN_GUARD_COUNT",
+        counts.manualGuardCount, "DECONFIG_REC_COUNT", counts.deconfigCount,
+        "PEL_COUNT", counts.unresolvedPelsCount);
 
     // create pels only for system guard and serviceable events and not for
     // manual guard or FCO
-    if ((guardCount > 0) || (unresolvedPelsCount > 0))
+    if ((counts.guardCount > 0) || (counts.unresolvedPelsCount > 0))
     {
         std::unordered_map<std::string, std::string> data = {
-            {"GUARD_RECORD_COUNT", std::to_string(guardCount)},
+            {"GUARD_RECORD_COUNT", std::to_string(counts.guardCount)},
             {"PEL_WITH_DECONFIG_BIT_COUNT",
-             std::to_string(unresolvedPelsCount)}};
+             std::to_string(counts.unresolvedPelsCount)}};
 
         auto method = bus.new_method_call(
             "xyz.openbmc_project.Logging", "/xyz/openbmc_project/logging",
             "xyz.openbmc_project.Logging.Create", "Create");
         method.append("org.open_power.Faultlog.Error.DeconfiguredHW",
                       Severity::Warning, data);
-        auto reply = method.call();
-        if (reply.is_method_error())
+        try
         {
-            lg2::error("Error in calling D-Bus method to create PEL");
+            // wait for the logging service to acknowledge the pel creation
+            // so that the process can exit as soon as the pel is created
+            bus.call(method,
+                     std::chrono::duration_cast<sdbusplus::SdBusDuration>(
+                         pelCreateTimeout));
+            lg2::info("faultlog pel is created");
+        }
+        catch (const sdbusplus::exception::SdBusError& ex)
+        {
+            lg2::error("Error in calling D-Bus method to create PEL {ERROR}",
+                       "ERROR", ex);
+            return false;
         }
     }
     else
@@ -120,38 +152,102 @@ void createNagPel(sdbusplus::bus::bus& bus,
         lg2::info("There are no pending service actions ignoring "
                   "creating fautlog pel");
     }
+    return true;
 }
 
-/** @brief Get unresolved guard records
+/** @brief Helper method to create faultlog pel
  *
- *  @return guard record list
+ *  @param[in] bus - D-Bus to attach to
+ *  @param[in] unresolvedRecords - hardware isolated records to parse
+ *  @param[in] ignorePwrFanPel - true - ignore pwr/fan pels
+ *  @param[in] diffMode - true - create only if the faultlog is changed
+ *                        since the previous faultlog pel creation
  */
-GuardRecords getGuardRecords()
+void createNagPel(sdbusplus::bus::bus& bus,
+                  const GuardRecords& unresolvedRecords, bool ignorePwrFanPel,
+                  bool diffMode)
 {
-    // Don't get ephemeral records because those type records are
-    // not intended to expose to the end user, just created for
-    // internal purpose to use by the BMC and Hostboot.
-    openpower::guard::GuardRecords records = openpower::guard::getAll(true);
-    GuardRecords unresolvedRecords;
-    // filter out all unused or resolved records
-    for (const auto& elem : records)
+    if (!diffMode)
     {
-        if (elem.recordId != GUARD_RESOLVED)
-        {
-            unresolvedRecords.emplace_back(elem);
-        }
+        (void)createNagPel(
+            bus, getNagCounts(bus, unresolvedRecords, ignorePwrFanPel));
+        return;
+    }
+
+    LoggingSnapshot logging(bus);
+    auto fingerprint = FaultLogFingerprint::capture(unresolvedRecords, logging,
+                                                    ignorePwrFanPel);
+    auto prevFingerprint = FaultLogFingerprint::load(nagFingerprintFile);
+    if (prevFingerprint.has_value() &&
+        FaultLogFingerprint::isSame(fingerprint, *prevFingerprint))
+    {
+        lg2::info("faultlog is not changed since the last run ignoring "
+                  "creating faultlog pel");
+        return;
+    }
+
+    // device tree is used only if the faultlog is changed
+    initPHAL();
+    DevTreeSnapshot devTree;
+    FaultLogFingerprint::captureDeconfigured(unresolvedRecords, devTree,
+                                             fingerprint);
+    lg2::info("faultlog changes since the last run {DIFF}", "DIFF",
+              FaultLogFingerprint::diff(prevFingerprint.value_or(Fingerprint{}),
+                                        fingerprint)
+                  .dump());
+
+    // save the fingerprint only if the pel is created so that the pel
+    // will be created again in the next run if it is failed now
+    auto counts = FaultLogReport::getNagCounts(bus, unresolvedRecords, devTree,
+                                               logging, ignorePwrFanPel);
+    if (createNagPel(bus, counts))
+    {
+        FaultLogFingerprint::save(nagFingerprintFile, fingerprint);
     }
-    return unresolvedRecords;
 }
 
-/** @brief Callback method for boot progress property change
+/** @brief Get the faultlog changes since the previous run
  *
  *  @param[in] bus - D-Bus to attach to
  *  @param[in] unresolvedRecords - hardware isolated records to parse
+ *
+ *  @return JSON array having ADDED and REMOVED sections
+ */
+nlohmann::json getFaultlogDiff(sdbusplus::bus::bus& bus,
+                               const GuardRecords& unresolvedRecords)
+{
+    LoggingSnapshot logging(bus);
+    auto fingerprint = FaultLogFingerprint::capture(unresolvedRecords, logging,
+                                                    !IGNORE_PWR_FAN_PEL);
+    auto prevFingerprint = FaultLogFingerprint::load(reportFingerprintFile);
+    if (prevFingerprint.has_value() &&
+        FaultLogFingerprint::isSame(fingerprint, *prevFingerprint))
+    {
+        // device tree is not changed so, the deconfigured targets too
+        fingerprint.deconfiguredTargets = prevFingerprint->deconfiguredTargets;
+    }
+    else
+    {
+        initPHAL();
+        DevTreeSnapshot devTree;
+        FaultLogFingerprint::captureDeconfigured(unresolvedRecords, devTree,
+                                                 fingerprint);
+        FaultLogFingerprint::save(reportFingerprintFile, fingerprint);
+    }
+    return FaultLogFingerprint::diff(prevFingerprint.value_or(Fingerprint{}),
+                                     fingerprint);
+}
+
+/** @brief Callback method for boot progress property change
+ *
+ *  @param[in] bus - D-Bus to attach to
  *  @param[in] msg - property change D-Bus message
+ *  @param[in] timer - timer to query the boot progress
+ *  @param[in] diffMode - true - create faultlog pel only if the faultlog
+ *                        is changed since the previous faultlog pel creation
  */
 void propertyChanged(sdbusplus::bus::bus& bus, sdbusplus::message::message& msg,
-                     Timer& timer)
+                     Timer& timer, bool diffMode)
 {
     // cancel the timer as we are getting property change requests
     // timer was added only to cater for bmc reboot when host is already
@@ -184,9 +280,11 @@ void propertyChanged(sdbusplus::bus::bus& bus, sdbusplus::message::message& msg,
                 {
                     lg2::info("faultlog - host poweron host reached "
                               "apply guard state creating nag pel");
-                    GuardRecords unresolvedRecords = getGuardRecords();
+                    GuardRecords unresolvedRecords =
+                        FaultLogReport::getGuardRecords();
                     // ipl/poweron ignore fan/power err
-                    createNagPel(bus, unresolvedRecords, IGNORE_PWR_FAN_PEL);
+                    createNagPel(bus, unresolvedRecords, IGNORE_PWR_FAN_PEL,
+                                 diffMode);
                     exit(EXIT_SUCCESS);
                 }
             }
@@ -200,22 +298,6 @@ void propertyChanged(sdbusplus::bus::bus& bus, sdbusplus::message::message& msg,
     }
 }
 
-/** @brief Method to add SERVICEABLE_EVENT section in faultlog
- *
- *  @param[in] errorlog - Holds the list of errorlogs
- *  @param[in] faultLogJson - Holds deconfig/guard record details
- */
-void addServiceableEvents(const nlohmann::json& errorlog,
-                          nlohmann::json& faultLogJson)
-{
-    if (!errorlog.empty())
-    {
-        nlohmann::json jsonServiceEvent;
-        jsonServiceEvent["SERVICEABLE_EVENT"] = errorlog;
-        faultLogJson.emplace_back(jsonServiceEvent);
-    }
-}
-
 int main(int argc, char** argv)
 {
     try
@@ -281,6 +363,12 @@ int main(int argc, char** argv)
         bool listFaultlog = false;
         bool bmcReboot = false;
         bool hostPowerOn = false;
+        bool streamOutput = false;
+        bool compactOutput = false;
+        int outputFd = STDOUT_FILENO;
+        std::string outputFormat = "json";
+        bool daemonMode = false;
+        bool diffMode = false;
 
         app.set_help_flag("-h, --help", "Faultlog tool options");
         app.add_flag("-g, --guardwterr", guardWithEid,
@@ -309,9 +397,69 @@ int main(int argc, char** argv)
                      "records present");
         app.add_flag("-f, --faultlog", listFaultlog,
                      "List all fault log records in JSON format");
+        app.add_flag("-s, --stream", streamOutput,
+                     "Write JSON records as each section is produced instead "
+                     "of building the whole JSON before writing");
+        app.add_flag("--compact", compactOutput,
+                     "Write JSON records without indentation");
+        app.add_option("--fd", outputFd,
+                       "File descriptor to write JSON records in stream mode, "
+                       "default is stdout");
+        app.add_option("--format", outputFormat,
+                       "Encoding of the fault log records, json (default), "
+                       "cbor or msgpack (positional layout)")
+            ->check(CLI::IsMember({"json", "cbor", "msgpack"}));
+        app.add_flag("--diff", diffMode,
+                     "Report only the changes since the previous run and "
+                     "skip creating faultlog pel if nothing is changed, "
+                     "supported with -f, -c, -r and -p");
+        app.add_flag("--daemon", daemonMode,
+                     "Run as daemon to serve fault log records and faultlog "
+                     "pel counts over D-Bus");
 
         CLI11_PARSE(app, argc, argv);
 
+        if (daemonMode)
+        {
+            initPHAL();
+            openpower::guard::libguard_init(false);
+            FaultLogDaemon faultLogDaemon(bus, event);
+
+            bus.request_name(FAULTLOG_BUSNAME);
+            bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
+            return event.loop();
+        }
+
+        bool printJson = listFaultlog || deconfig || unresolvedPels ||
+                         policy || guardWithoutEid || guardWithEid;
+
+        if (streamOutput && outputFormat != "json")
+        {
+            lg2::error("Stream mode is supported only for json format");
+            exit(EXIT_FAILURE);
+        }
+
+        if (diffMode && (guardWithEid || guardWithoutEid || policy ||
+                         unresolvedPels || deconfig))
+        {
+            lg2::error("Diff mode is supported only with faultlog and "
+                       "faultlog pel options");
+            exit(EXIT_FAILURE);
+        }
+
+        // write VERSION and SYSTEM header immediately in stream mode and
+        // each section records once populated
+        std::optional<JsonStreamWriter> streamWriter;
+        if (printJson && streamOutput)
+        {
+            streamWriter.emplace(outputFd, compactOutput);
+            streamWriter->begin();
+            streamWriter->writeAll(faultLogJson);
+            faultLogJson = json::array();
+        }
+        JsonStreamWriter* writer = streamWriter.has_value() ? &(*streamWriter)
+                                                            : nullptr;
+
         // create bmc reboot pel
         if (bmcReboot)
         {
@@ -325,57 +473,134 @@ int main(int argc, char** argv)
             }
         }
 
-        initPHAL();
-        openpower::guard::libguard_init(false);
-        GuardRecords unresolvedRecords = getGuardRecords();
+        // the faultlog daemon keeps the device tree, guard records and
+        // logging entries in memory so, use it if running instead of
+        // reading them again
+        bool localOnly = guardWithEid || guardWithoutEid || policy ||
+                         unresolvedPels || deconfig || hostPowerOn || diffMode;
+        bool useDaemon = !localOnly &&
+                         (bmcReboot || createPel || listFaultlog) &&
+                         FaultLogClient::isDaemonRunning(bus);
+
+        // fallback to collect locally if the faultlog daemon is failed
+        // to respond (for example, restarted or timed out)
+        std::optional<NagCounts> daemonNagCounts;
+        nlohmann::json daemonReport = json::array();
+        if (useDaemon)
+        {
+            try
+            {
+                if (bmcReboot || createPel)
+                {
+                    daemonNagCounts = FaultLogClient::getNagCounts(
+                        bus, !IGNORE_PWR_FAN_PEL);
+                }
+                else
+                {
+                    daemonReport = FaultLogClient::getReport(bus);
+                }
+            }
+            catch (const std::exception& ex)
+            {
+                lg2::error("Failed to get the faultlog from the faultlog "
+                           "daemon, collecting locally {ERROR}",
+                           "ERROR", ex);
+                useDaemon = false;
+            }
+        }
+
+        GuardRecords unresolvedRecords;
+        if (!useDaemon)
+        {
+            // in diff mode, device tree is used only if the faultlog is
+            // changed since the previous run
+            if (!diffMode)
+            {
+                initPHAL();
+            }
+            openpower::guard::libguard_init(false);
+            unresolvedRecords = FaultLogReport::getGuardRecords();
+        }
 
         // host will be already on, create nagpel
         if (bmcReboot)
         {
-            createNagPel(bus, unresolvedRecords, !IGNORE_PWR_FAN_PEL);
+            if (useDaemon)
+            {
+                (void)createNagPel(bus, *daemonNagCounts);
+            }
+            else
+            {
+                createNagPel(bus, unresolvedRecords, !IGNORE_PWR_FAN_PEL,
+                             diffMode);
+            }
         }
         // guard records with associated error object
         else if (guardWithEid)
         {
             // serviceable event records
+            DevTreeSnapshot devTree;
+            LoggingSnapshot logging(bus);
             nlohmann::json errorlog = json::array();
             (void)GuardWithEidRecords::populate(bus, unresolvedRecords,
-                                                errorlog);
-            addServiceableEvents(errorlog, faultLogJson);
+                                                devTree, logging, errorlog);
+            FaultLogReport::addServiceableEvents(errorlog, faultLogJson,
+                                                 writer);
         }
 
         // guard records without any associated error object
         else if (guardWithoutEid)
         {
-            (void)GuardWithoutEidRecords::populate(unresolvedRecords,
-                                                   faultLogJson);
+            DevTreeSnapshot devTree;
+            nlohmann::json records = json::array();
+            (void)GuardWithoutEidRecords::populate(unresolvedRecords, devTree,
+                                                   records);
+            FaultLogReport::addRecords(records, faultLogJson, writer);
         }
 
         // guard policy
         else if (policy)
         {
-            (void)FaultLogPolicy::populate(bus, faultLogJson);
+            nlohmann::json records = json::array();
+            (void)FaultLogPolicy::populate(bus, records);
+            FaultLogReport::addRecords(records, faultLogJson, writer);
         }
 
         // unresolved pels with deconfig bit set
         else if (unresolvedPels)
         {
             // serviceable event records
+            DevTreeSnapshot devTree;
+            LoggingSnapshot logging(bus);
             nlohmann::json errorlog = json::array();
-            (void)UnresolvedPELs::populate(bus, unresolvedRecords, errorlog);
-            addServiceableEvents(errorlog, faultLogJson);
+            (void)UnresolvedPELs::populate(bus, unresolvedRecords, devTree,
+                                           logging, errorlog);
+            FaultLogReport::addServiceableEvents(errorlog, faultLogJson,
+                                                 writer);
         }
 
         // pdbg targets with deconfig bit set
         else if (deconfig)
         {
-            (void)DeconfigRecords::populate(unresolvedRecords, faultLogJson);
+            DevTreeSnapshot devTree;
+            nlohmann::json records = json::array();
+            (void)DeconfigRecords::populate(unresolvedRecords, devTree,
+                                            records);
+            FaultLogReport::addRecords(records, faultLogJson, writer);
         }
 
         // create fault log pel if there are service actions pending
         else if (createPel)
         {
-            createNagPel(bus, unresolvedRecords, !IGNORE_PWR_FAN_PEL);
+            if (useDaemon)
+            {
+                (void)createNagPel(bus, *daemonNagCounts);
+            }
+            else
+            {
+                createNagPel(bus, unresolvedRecords, !IGNORE_PWR_FAN_PEL,
+                             diffMode);
+            }
         }
         // host poweron service is called both for bmc reboot and host poweron
         // need to decide bmc reboot based on host boot progress state
@@ -385,8 +610,9 @@ int main(int argc, char** argv)
             {
                 lg2::info("faultlog hostpoweron host is already in running "
                           "state consider it as bmc reboot ");
-                createNagPel(bus, unresolvedRecords,
-                             !IGNORE_PWR_FAN_PEL); // add as it is bmcreboot
+                // add as it is bmcreboot
+                createNagPel(bus, unresolvedRecords, !IGNORE_PWR_FAN_PEL,
+                             diffMode);
             }
             else
             {
@@ -396,14 +622,14 @@ int main(int argc, char** argv)
                 // file and updates D-Bus property. Using timer to query the
                 // progress to cater fore bmc reboot case.
                 auto timerCb = [&bus, &unresolvedRecords,
-                                hostPowerOn](Timer& timer) {
+                                diffMode](Timer& timer) {
                     if (isHostProgressStateRunning(bus))
                     {
                         lg2::info("faultlog poweron timer host reached running "
                                   "state consider it a bmcreboot");
-                        createNagPel(
-                            bus, unresolvedRecords,
-                            !IGNORE_PWR_FAN_PEL); // add as it is bmcreboot
+                        // add as it is bmcreboot
+                        createNagPel(bus, unresolvedRecords,
+                                     !IGNORE_PWR_FAN_PEL, diffMode);
                         timer.setEnabled(false);
                         exit(EXIT_SUCCESS);
                     }
@@ -421,8 +647,8 @@ int main(int argc, char** argv)
                             "/xyz/openbmc_project/state/host0",
                             "xyz.openbmc_project.State.Boot."
                             "Progress"),
-                        [&bus, &unresolvedRecords, &timer](auto& msg) {
-                    propertyChanged(bus, msg, timer);
+                        [&bus, &timer, diffMode](auto& msg) {
+                    propertyChanged(bus, msg, timer, diffMode);
                 });
 
                 bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
@@ -432,29 +658,48 @@ int main(int argc, char** argv)
         // write faultlog json to stdout
         else if (listFaultlog)
         {
-            (void)FaultLogPolicy::populate(bus, faultLogJson);
-            // serviceable event records
-            nlohmann::json errorlog = json::array();
-            (void)GuardWithEidRecords::populate(bus, unresolvedRecords,
-                                                errorlog);
-            (void)UnresolvedPELs::populate(bus, unresolvedRecords, errorlog);
-            addServiceableEvents(errorlog, faultLogJson);
-
-            //
-            // deconfigured records count
-            (void)GuardWithoutEidRecords::populate(unresolvedRecords,
-                                                   faultLogJson);
-            (void)DeconfigRecords::populate(unresolvedRecords, faultLogJson);
+            if (useDaemon)
+            {
+                FaultLogReport::addRecords(daemonReport, faultLogJson, writer);
+            }
+            else if (diffMode)
+            {
+                nlohmann::json records = getFaultlogDiff(bus,
+                                                         unresolvedRecords);
+                FaultLogReport::addRecords(records, faultLogJson, writer);
+            }
+            else
+            {
+                // single device tree traversal and logging entries read for
+                // all the sections, device tree is traversed concurrently
+                // with the D-Bus calls
+                FaultLogReport::populateConcurrently(bus, unresolvedRecords,
+                                                     faultLogJson, writer);
+            }
         }
         else
         {
             lg2::error("Invalid option");
         }
 
-        if (listFaultlog || deconfig || unresolvedPels || policy ||
-            guardWithoutEid || guardWithEid)
+        if (streamWriter.has_value())
+        {
+            streamWriter->end();
+        }
+        else if (printJson && outputFormat != "json")
+        {
+            // sections and fields are encoded by their position so that
+            // the consumers need not to look up by the string keys
+            std::vector<std::uint8_t> encoded =
+                FaultLogBinaryLayout::encode(faultLogJson, outputFormat);
+            std::cout.write(reinterpret_cast<const char*>(encoded.data()),
+                            static_cast<std::streamsize>(encoded.size()));
+            std::cout.flush();
+        }
+        else if (printJson)
         {
-            std::cout << faultLogJson.dump(2) << std::endl;
+            std::cout << faultLogJson.dump(compactOutput ? -1 : 2)
+                      << std::endl;
         }
     }
     catch (const std::exception& e)
@@ -462,7 +707,5 @@ int main(int argc, char** argv)
         lg2::error("Failed {ERROR}", "ERROR", e.what());
         exit(EXIT_FAILURE);
     }
-    // wait for a while for the D-Bus method to complete-
-    sleep(2);
     return 0;
 }
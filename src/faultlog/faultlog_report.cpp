@@ -0,0 +1,235 @@
+#include <deconfig_records.hpp>
+#include <faultlog_policy.hpp>
+#include <faultlog_report.hpp>
+#include <guard_with_eid_records.hpp>
+#include <guard_without_eid_records.hpp>
+#include <libguard/guard_interface.hpp>
+#include <phosphor-logging/lg2.hpp>
+#include <unresolved_pels.hpp>
+
+#include <exception>
+#include <future>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace openpower::faultlog
+{
+
+using ::nlohmann::json;
+
+#define GUARD_RESOLVED 0xFFFFFFFF
+
+GuardRecords FaultLogReport::getGuardRecords()
+{
+    // Don't get ephemeral records because those type records are
+    // not intended to expose to the end user, just created for
+    // internal purpose to use by the BMC and Hostboot.
+    openpower::guard::GuardRecords records = openpower::guard::getAll(true);
+    GuardRecords unresolvedRecords;
+    // filter out all unused or resolved records
+    for (const auto& elem : records)
+    {
+        if (elem.recordId != GUARD_RESOLVED)
+        {
+            unresolvedRecords.emplace_back(elem);
+        }
+    }
+    return unresolvedRecords;
+}
+
+NagCounts FaultLogReport::getNagCounts(sdbusplus::bus::bus& bus,
+                                       const GuardRecords& guardRecords,
+                                       const DevTreeSnapshot& devTree,
+                                       const LoggingSnapshot& logging,
+                                       bool ignorePwrFanPel)
+{
+    NagCounts counts;
+
+    //
+    // serviceable records count
+    counts.guardCount = GuardWithEidRecords::getCount(bus, guardRecords,
+                                                      devTree, logging);
+    counts.unresolvedPelsCount = UnresolvedPELs::getCount(bus, logging,
+                                                          ignorePwrFanPel);
+
+    //
+    // deconfigured records count
+    counts.manualGuardCount = GuardWithoutEidRecords::getCount(guardRecords);
+    counts.deconfigCount = DeconfigRecords::getCount(guardRecords, devTree);
+    return counts;
+}
+
+void FaultLogReport::populate(sdbusplus::bus::bus& bus,
+                              const GuardRecords& guardRecords,
+                              const DevTreeSnapshot& devTree,
+                              const LoggingSnapshot& logging,
+                              json& faultLogJson, JsonStreamWriter* writer)
+{
+    json policyRecords = json::array();
+    (void)FaultLogPolicy::populate(bus, policyRecords);
+    addRecords(policyRecords, faultLogJson, writer);
+
+    // serviceable event records
+    populateServiceableEvents(bus, guardRecords, devTree, logging,
+                              faultLogJson, writer);
+
+    //
+    // deconfigured records
+    json manualGuardRecords = json::array();
+    (void)GuardWithoutEidRecords::populate(guardRecords, devTree,
+                                           manualGuardRecords);
+    addRecords(manualGuardRecords, faultLogJson, writer);
+
+    json deconfigRecords = json::array();
+    (void)DeconfigRecords::populate(guardRecords, devTree, deconfigRecords);
+    addRecords(deconfigRecords, faultLogJson, writer);
+}
+
+void FaultLogReport::populateConcurrently(sdbusplus::bus::bus& bus,
+                                          const GuardRecords& guardRecords,
+                                          json& faultLogJson,
+                                          JsonStreamWriter* writer)
+{
+    // The device tree traversal and the device tree only sections are
+    // evaluated in a worker thread while the D-Bus work is done in this
+    // thread so, pdbg and libguard are used only by one thread at a time.
+    struct DevTreeSections
+    {
+        std::unique_ptr<DevTreeSnapshot> devTree;
+        json manualGuardRecords = json::array();
+        json deconfigRecords = json::array();
+    };
+    auto devTreeWork = std::async(std::launch::async, [&guardRecords]() {
+        DevTreeSections sections;
+        sections.devTree = std::make_unique<DevTreeSnapshot>();
+        (void)GuardWithoutEidRecords::populate(
+            guardRecords, *sections.devTree, sections.manualGuardRecords);
+        (void)DeconfigRecords::populate(guardRecords, *sections.devTree,
+                                        sections.deconfigRecords);
+        return sections;
+    });
+
+    json policyRecords = json::array();
+    std::optional<LoggingSnapshot> logging;
+    try
+    {
+        (void)FaultLogPolicy::populate(bus, policyRecords);
+        logging.emplace(bus);
+
+        // PEL ids of the guard records to find the guarded PELs
+        std::vector<uint32_t> eids;
+        for (const auto& elem : guardRecords)
+        {
+            if (elem.elogId != 0)
+            {
+                eids.push_back(static_cast<uint32_t>(elem.elogId));
+            }
+        }
+        logging->prefetchEids(bus, eids);
+    }
+    catch (...)
+    {
+        // wait for the worker thread since it uses the guard records
+        devTreeWork.wait();
+        throw;
+    }
+    addRecords(policyRecords, faultLogJson, writer);
+
+    // serviceable event records need both the device tree and the logging
+    // entries
+    DevTreeSections sections = devTreeWork.get();
+    populateServiceableEvents(bus, guardRecords, *sections.devTree, *logging,
+                              faultLogJson, writer);
+
+    addRecords(sections.manualGuardRecords, faultLogJson, writer);
+    addRecords(sections.deconfigRecords, faultLogJson, writer);
+}
+
+void FaultLogReport::populateServiceableEvents(
+    sdbusplus::bus::bus& bus, const GuardRecords& guardRecords,
+    const DevTreeSnapshot& devTree, const LoggingSnapshot& logging,
+    json& faultLogJson, JsonStreamWriter* writer)
+{
+    if (writer == nullptr)
+    {
+        json errorlog = json::array();
+        (void)GuardWithEidRecords::populate(bus, guardRecords, devTree,
+                                            logging, errorlog);
+        (void)UnresolvedPELs::populate(bus, guardRecords, devTree, logging,
+                                       errorlog);
+        addServiceableEvents(errorlog, faultLogJson, writer);
+        return;
+    }
+
+    // write each CEC_ERROR_LOG element once populated instead of building
+    // the whole section, the section is written only if it has elements
+    bool sectionStarted = false;
+    std::exception_ptr writeError;
+    auto writeErrorLog = [writer, &sectionStarted,
+                          &writeError](json&& errorLog) {
+        // the write failure is kept to throw after populating since
+        // the populate methods catch the exceptions to skip the record
+        if (writeError)
+        {
+            return;
+        }
+        try
+        {
+            if (!sectionStarted)
+            {
+                writer->beginSection("SERVICEABLE_EVENT");
+                sectionStarted = true;
+            }
+            writer->writeSectionElement(errorLog);
+        }
+        catch (...)
+        {
+            writeError = std::current_exception();
+        }
+    };
+    (void)GuardWithEidRecords::populate(bus, guardRecords, devTree, logging,
+                                        writeErrorLog);
+    (void)UnresolvedPELs::populate(bus, guardRecords, devTree, logging,
+                                   writeErrorLog);
+    if (writeError)
+    {
+        std::rethrow_exception(writeError);
+    }
+    if (sectionStarted)
+    {
+        writer->endSection();
+    }
+}
+
+void FaultLogReport::addServiceableEvents(const json& errorlog,
+                                          json& faultLogJson,
+                                          JsonStreamWriter* writer)
+{
+    if (!errorlog.empty())
+    {
+        if (writer != nullptr)
+        {
+            writer->writeSection("SERVICEABLE_EVENT", errorlog);
+            return;
+        }
+        json jsonServiceEvent;
+        jsonServiceEvent["SERVICEABLE_EVENT"] = errorlog;
+        faultLogJson.emplace_back(jsonServiceEvent);
+    }
+}
+
+void FaultLogReport::addRecords(json& records, json& faultLogJson,
+                                JsonStreamWriter* writer)
+{
+    if (writer != nullptr)
+    {
+        writer->writeAll(records);
+        return;
+    }
+    for (auto& record : records)
+    {
+        faultLogJson.push_back(std::move(record));
+    }
+}
+} // namespace openpower::faultlog
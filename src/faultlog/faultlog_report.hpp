@@ -0,0 +1,140 @@
+#pragma once
+
+#include <devtree_snapshot.hpp>
+#include <json_stream_writer.hpp>
+#include <libguard/include/guard_record.hpp>
+#include <logging_snapshot.hpp>
+#include <nlohmann/json.hpp>
+#include <sdbusplus/bus.hpp>
+
+namespace openpower::faultlog
+{
+using ::openpower::guard::GuardRecords;
+
+/**
+ * @brief Count of the records considered to create the faultlog (NAG) pel
+ */
+struct NagCounts
+{
+    int guardCount = 0;
+    int manualGuardCount = 0;
+    int deconfigCount = 0;
+    int unresolvedPelsCount = 0;
+};
+
+/**
+ * @class FaultLogReport
+ *
+ * Captures all the faultlog sections so that the faultlog tool and the
+ * faultlog daemon produce the same faultlog.
+ */
+class FaultLogReport
+{
+  private:
+    FaultLogReport() = delete;
+    FaultLogReport(const FaultLogReport&) = delete;
+    FaultLogReport& operator=(const FaultLogReport&) = delete;
+    FaultLogReport(FaultLogReport&&) = delete;
+    FaultLogReport& operator=(FaultLogReport&&) = delete;
+    ~FaultLogReport() = delete;
+
+  public:
+    /** @brief Get unresolved guard records
+     *
+     *  @return guard record list
+     */
+    static GuardRecords getGuardRecords();
+
+    /** @brief Get count of the records to create the faultlog pel
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *  @param[in] guardRecords - Guard records
+     *  @param[in] devTree - device tree targets details
+     *  @param[in] logging - logging entries details
+     *  @param[in] ignorePwrFanPel - true - ignore pwr/fan pels
+     */
+    static NagCounts getNagCounts(sdbusplus::bus::bus& bus,
+                                  const GuardRecords& guardRecords,
+                                  const DevTreeSnapshot& devTree,
+                                  const LoggingSnapshot& logging,
+                                  bool ignorePwrFanPel);
+
+    /** @brief Captured all the faultlog sections in faultlog JSON
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *  @param[in] guardRecords - Guard records
+     *  @param[in] devTree - device tree targets details
+     *  @param[in] logging - logging entries details
+     *  @param[in] faultLogJson - Holds deconfig/guard record details
+     *  @param[in] writer - stream writer to write the sections immediately,
+     *                      nullptr to add the sections in faultLogJson
+     */
+    static void populate(sdbusplus::bus::bus& bus,
+                         const GuardRecords& guardRecords,
+                         const DevTreeSnapshot& devTree,
+                         const LoggingSnapshot& logging,
+                         nlohmann::json& faultLogJson,
+                         JsonStreamWriter* writer);
+
+    /** @brief Captured all the faultlog sections in faultlog JSON by
+     *         evaluating the device tree and the D-Bus work concurrently
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *  @param[in] guardRecords - Guard records
+     *  @param[in] faultLogJson - Holds deconfig/guard record details
+     *  @param[in] writer - stream writer to write the sections immediately,
+     *                      nullptr to add the sections in faultLogJson
+     *
+     *  @note The sections are added in the same order as populate().
+     */
+    static void populateConcurrently(sdbusplus::bus::bus& bus,
+                                     const GuardRecords& guardRecords,
+                                     nlohmann::json& faultLogJson,
+                                     JsonStreamWriter* writer);
+
+    /** @brief Method to add SERVICEABLE_EVENT section in faultlog
+     *
+     *  @param[in] errorlog - Holds the list of errorlogs
+     *  @param[in] faultLogJson - Holds deconfig/guard record details
+     *  @param[in] writer - stream writer to write the section immediately,
+     *                      nullptr to add the section in faultLogJson
+     */
+    static void addServiceableEvents(const nlohmann::json& errorlog,
+                                     nlohmann::json& faultLogJson,
+                                     JsonStreamWriter* writer);
+
+    /** @brief Method to add the section records in faultlog
+     *
+     *  @param[in] records - Holds the list of section records
+     *  @param[in] faultLogJson - Holds deconfig/guard record details
+     *  @param[in] writer - stream writer to write the records immediately,
+     *                      nullptr to add the records in faultLogJson
+     */
+    static void addRecords(nlohmann::json& records,
+                           nlohmann::json& faultLogJson,
+                           JsonStreamWriter* writer);
+
+  private:
+    /** @brief Method to populate and add SERVICEABLE_EVENT section in
+     *         faultlog
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *  @param[in] guardRecords - Guard records
+     *  @param[in] devTree - device tree targets details
+     *  @param[in] logging - logging entries details
+     *  @param[in] faultLogJson - Holds deconfig/guard record details
+     *  @param[in] writer - stream writer to write each errorlog of the
+     *                      section once populated, nullptr to add the
+     *                      section in faultLogJson
+     *
+     *  @note The errorlogs of the guard records are written once all the
+     *        guard records are parsed since those are merged by PEL.
+     */
+    static void populateServiceableEvents(sdbusplus::bus::bus& bus,
+                                          const GuardRecords& guardRecords,
+                                          const DevTreeSnapshot& devTree,
+                                          const LoggingSnapshot& logging,
+                                          nlohmann::json& faultLogJson,
+                                          JsonStreamWriter* writer);
+};
+} // namespace openpower::faultlog
@@ -1,5 +1,4 @@
 #include <attributes_info.H>
-#include <libphal.H>
 
 #include <guard_with_eid_records.hpp>
 #include <libguard/guard_interface.hpp>
@@ -18,48 +17,10 @@ using ::nlohmann::json;
 constexpr auto stateConfigured = "CONFIGURED";
 constexpr auto stateDeconfigured = "DECONFIGURED";
 
-/** Data structure to pass to pdbg_target_traverse callback method*/
-struct GuardedTarget
-{
-    pdbg_target* target = nullptr;
-    std::string phyDevPath = {};
-    GuardedTarget(const std::string& path) : phyDevPath(path) {}
-};
-
-using PropertyValue =
-    std::variant<std::string, bool, uint8_t, int16_t, uint16_t, int32_t,
-                 uint32_t, int64_t, uint64_t, double>;
-
-using Properties = std::map<std::string, PropertyValue>;
-/**
- * @brief Get PDBG target matching the guarded target physicalpath
- *
- * This callback function is called as part of the recursive method
- * pdbg_target_traverse, recursion will exit when the method return 1
- * else continues till the target is found
- *
- * @param[in] target - pdbg target to compare
- * @param[inout] priv - data structure passed to the callback method
- *
- * @return 1 when target is found else 0
- */
-static int getGuardedTarget(struct pdbg_target* target, void* priv)
-{
-    GuardedTarget* guardTarget = reinterpret_cast<GuardedTarget*>(priv);
-    ATTR_PHYS_DEV_PATH_Type phyPath;
-    if (!DT_GET_PROP(ATTR_PHYS_DEV_PATH, target, phyPath))
-    {
-        if (strcmp(phyPath, guardTarget->phyDevPath.c_str()) == 0)
-        {
-            guardTarget->target = target;
-            return 1;
-        }
-    }
-    return 0;
-}
-
 int GuardWithEidRecords::getCount(sdbusplus::bus::bus& bus,
-                                  const GuardRecords& guardRecords)
+                                  const GuardRecords& guardRecords,
+                                  const DevTreeSnapshot& devTree,
+                                  const LoggingSnapshot& logging)
 {
     // An error could create single PEL but multiple guard records, while
     // processing guard records do not create multiple error log sections
@@ -94,69 +55,35 @@ int GuardWithEidRecords::getCount(sdbusplus::bus::bus& bus,
             continue;
         }
 
-        GuardedTarget guardedTarget(*physicalPath);
-        pdbg_target_traverse(nullptr, getGuardedTarget, &guardedTarget);
-        if (guardedTarget.target == nullptr)
+        const TargetInfo* guardedTarget = devTree.find(*physicalPath);
+        if (guardedTarget == nullptr)
         {
             lg2::error("Failed to find the pdbg target for the guarded "
                        "target {RECORD_ID}",
                        "RECORD_ID", elem.recordId);
             continue;
         }
-        ATTR_HWAS_STATE_Type hwasState;
-        if (DT_GET_PROP(ATTR_HWAS_STATE, guardedTarget.target, hwasState))
+        if (!guardedTarget->hwasState.has_value())
         {
             lg2::error("Failed to get HWAS state of the guarded "
                        "target {RECORD_ID}",
                        "RECORD_ID", elem.recordId);
             continue;
         }
-        bool dbusErrorObjFound = true;
-        uint32_t bmcLogId = 0;
-        try
-        {
-            auto method = bus.new_method_call(
-                "xyz.openbmc_project.Logging", "/xyz/openbmc_project/logging",
-                "org.open_power.Logging.PEL", "GetBMCLogIdFromPELId");
-
-            method.append(static_cast<uint32_t>(elem.elogId));
-            auto resp = bus.call(method);
-            resp.read(bmcLogId);
-        }
-        catch (const sdbusplus::exception::SdBusError& ex)
-        {
-            dbusErrorObjFound = false;
-            lg2::info(
-                "PEL might be deleted but guard entry is around {ELOG_ID)",
-                "ELOG_ID", elem.elogId);
-        }
+        const ATTR_HWAS_STATE_Type& hwasState = *guardedTarget->hwasState;
         uint32_t plid = 0;
-        if (dbusErrorObjFound)
+        const LogEntry* logEntry = logging.findByEid(
+            bus, static_cast<uint32_t>(elem.elogId));
+        if (logEntry != nullptr)
         {
-            Properties pelEntryProp;
-            std::string objPath = "/xyz/openbmc_project/logging/entry/" +
-                                  std::to_string(bmcLogId);
-            auto pelEntryMethod = bus.new_method_call(
-                "xyz.openbmc_project.Logging", objPath.c_str(),
-                "org.freedesktop.DBus.Properties", "GetAll");
-            pelEntryMethod.append("org.open_power.Logging.PEL.Entry");
-            auto pelEntryReply = bus.call(pelEntryMethod);
-            pelEntryReply.read(pelEntryProp);
-            for (const auto& [prop, propValue] : pelEntryProp)
-            {
-                if (prop == "PlatformLogID")
-                {
-                    auto plidPtr = std::get_if<uint32_t>(&propValue);
-                    if (plidPtr != nullptr)
-                    {
-                        plid = *plidPtr;
-                    }
-                }
-            }
+            plid = logEntry->plid;
         }
         // D-Bus error object might be deleted
         else
         {
+            lg2::info(
+                "PEL might be deleted but guard entry is around {ELOG_ID}",
+                "ELOG_ID", elem.elogId);
             // hwas state will be updated only during reipl till then plid will
             // be zero, if zero assume it as new serviceable event else check if
             // it is already processed
@@ -185,11 +112,25 @@ int GuardWithEidRecords::getCount(sdbusplus::bus::bus& bus,
 
 void GuardWithEidRecords::populate(sdbusplus::bus::bus& bus,
                                    const GuardRecords& guardRecords,
+                                   const DevTreeSnapshot& devTree,
+                                   const LoggingSnapshot& logging,
                                    json& jsonServEvent)
+{
+    populate(bus, guardRecords, devTree, logging,
+             [&jsonServEvent](json&& errorLog) {
+                 jsonServEvent.emplace_back(std::move(errorLog));
+             });
+}
+
+void GuardWithEidRecords::populate(
+    sdbusplus::bus::bus& bus, const GuardRecords& guardRecords,
+    const DevTreeSnapshot& devTree, const LoggingSnapshot& logging,
+    const std::function<void(json&&)>& addErrorLog)
 {
     // to allow duplicte pels that are deleted which will have plid as zero till
     // reipl
     std::multimap<uint32_t, json> processedPelMap;
+    auto guardReasons = getGuardReasons(guardRecords);
 
     for (const auto& elem : guardRecords)
     {
@@ -209,123 +150,47 @@ void GuardWithEidRecords::populate(sdbusplus::bus::bus& bus,
                 continue;
             }
 
-            GuardedTarget guardedTarget(*physicalPath);
-            pdbg_target_traverse(nullptr, getGuardedTarget, &guardedTarget);
-            if (guardedTarget.target == nullptr)
+            const TargetInfo* guardedTarget = devTree.find(*physicalPath);
+            if (guardedTarget == nullptr)
             {
                 lg2::error("Failed to find the pdbg target for the guarded "
                            "target {RECORD_ID}",
                            "RECORD_ID", elem.recordId);
                 continue;
             }
-            ATTR_HWAS_STATE_Type hwasState;
-            if (DT_GET_PROP(ATTR_HWAS_STATE, guardedTarget.target, hwasState))
+            if (!guardedTarget->hwasState.has_value())
             {
                 lg2::error("Failed to get HWAS state of the guarded "
                            "target {RECORD_ID}",
                            "RECORD_ID", elem.recordId);
                 continue;
             }
-            uint32_t bmcLogId = 0;
+            const ATTR_HWAS_STATE_Type& hwasState = *guardedTarget->hwasState;
             uint32_t plid = 0;
             json jsonErrorLog = json::object();
-            bool dbusErrorObjFound = true;
-            try
-            {
-                auto method = bus.new_method_call(
-                    "xyz.openbmc_project.Logging",
-                    "/xyz/openbmc_project/logging",
-                    "org.open_power.Logging.PEL", "GetBMCLogIdFromPELId");
-
-                method.append(static_cast<uint32_t>(elem.elogId));
-                auto resp = bus.call(method);
-                resp.read(bmcLogId);
-            }
-            catch (const sdbusplus::exception::SdBusError& ex)
-            {
-                dbusErrorObjFound = false;
-                lg2::info(
-                    "PEL might be deleted but guard entry is around {ELOG_ID}",
-                    "ELOG_ID", elem.elogId);
-            }
-            if (dbusErrorObjFound)
+            const LogEntry* logEntry = logging.findByEid(
+                bus, static_cast<uint32_t>(elem.elogId));
+            if (logEntry != nullptr)
             {
-                std::string callouts;
-                std::string refCode;
-                std::string objPath = "/xyz/openbmc_project/logging/entry/" +
-                                      std::to_string(bmcLogId);
-                Properties loggingEntryProp;
-                auto loggingEntryMethod = bus.new_method_call(
-                    "xyz.openbmc_project.Logging", objPath.c_str(),
-                    "org.freedesktop.DBus.Properties", "GetAll");
-                loggingEntryMethod.append("xyz.openbmc_project.Logging.Entry");
-                auto loggingEntryReply = bus.call(loggingEntryMethod);
-                loggingEntryReply.read(loggingEntryProp);
-                for (const auto& [prop, propValue] : loggingEntryProp)
-                {
-                    if (prop == "Resolution")
-                    {
-                        auto calloutsPtr = std::get_if<std::string>(&propValue);
-                        if (calloutsPtr != nullptr)
-                        {
-                            callouts = *calloutsPtr;
-                        }
-                    }
-                    else if (prop == "EventId")
-                    {
-                        auto eventIdPtr = std::get_if<std::string>(&propValue);
-                        if (eventIdPtr != nullptr)
-                        {
-                            std::istringstream iss(*eventIdPtr);
-                            iss >> refCode;
-                        }
-                    }
-                } // endfor
-                uint64_t timestamp = 0;
-                Properties pelEntryProp;
-                auto pelEntryMethod = bus.new_method_call(
-                    "xyz.openbmc_project.Logging", objPath.c_str(),
-                    "org.freedesktop.DBus.Properties", "GetAll");
-                pelEntryMethod.append("org.open_power.Logging.PEL.Entry");
-                auto pelEntryReply = bus.call(pelEntryMethod);
-                pelEntryReply.read(pelEntryProp);
-                for (const auto& [prop, propValue] : pelEntryProp)
-                {
-                    if (prop == "PlatformLogID")
-                    {
-                        auto plidPtr = std::get_if<uint32_t>(&propValue);
-                        if (plidPtr != nullptr)
-                        {
-                            plid = *plidPtr;
-                        }
-                    }
-                    else if (prop == "Timestamp")
-                    {
-                        auto timestampPtr = std::get_if<uint64_t>(&propValue);
-                        if (timestampPtr != nullptr)
-                        {
-                            timestamp = *timestampPtr;
-                        }
-                    }
-                }
+                plid = logEntry->plid;
                 std::stringstream ss;
                 ss << std::hex << "0x" << plid;
                 jsonErrorLog["PLID"] = ss.str();
-                jsonErrorLog["Callout Section"] = parseCallout(callouts);
-                jsonErrorLog["SRC"] = refCode;
-                jsonErrorLog["DATE_TIME"] = epochTimeToBCD(timestamp);
+                jsonErrorLog["Callout Section"] =
+                    parseCallout(logEntry->callouts);
+                jsonErrorLog["SRC"] = logEntry->refCode;
+                jsonErrorLog["DATE_TIME"] = epochTimeToBCD(logEntry->timestamp);
             }
             else
             {
+                lg2::info(
+                    "PEL might be deleted but guard entry is around {ELOG_ID}",
+                    "ELOG_ID", elem.elogId);
+
                 json jsonCallout = json::object();
                 json sectionJson = json::object();
 
-                // getLocationCode checks if attr is present in target else
-                // gets it from parent target
-                ATTR_LOCATION_CODE_Type attrLocCode = {'\0'};
-                openpower::phal::pdbg::getLocationCode(guardedTarget.target,
-                                                       attrLocCode);
-                jsonCallout["Location Code"] = attrLocCode;
+                jsonCallout["Location Code"] = guardedTarget->locationCode();
 
                 sectionJson["Callout Count"] = 1;
                 sectionJson["Callouts"] = jsonCallout;
@@ -340,7 +205,7 @@ void GuardWithEidRecords::populate(sdbusplus::bus::bus& bus,
 
             // populate resource actions section
             json jsonResource = json::object();
-            jsonResource["TYPE"] = pdbgTargetName(guardedTarget.target);
+            jsonResource["TYPE"] = pdbgTargetName(guardedTarget->target);
             std::string state = stateDeconfigured;
             if (hwasState.functional)
             {
@@ -348,22 +213,15 @@ void GuardWithEidRecords::populate(sdbusplus::bus::bus& bus,
             }
             jsonResource["CURRENT_STATE"] = std::move(state);
 
-            // getLocationCode checks if attr is present in target else
-            // gets it from partent target
-            ATTR_LOCATION_CODE_Type attrLocCode = {'\0'};
-            openpower::phal::pdbg::getLocationCode(guardedTarget.target,
-                                                   attrLocCode);
-            jsonResource["LOCATION_CODE"] = attrLocCode;
+            jsonResource["LOCATION_CODE"] = guardedTarget->locationCode();
 
-            jsonResource["REASON_DESCRIPTION"] = getGuardReason(guardRecords,
-                                                                *physicalPath);
+            auto guardReason = guardReasons.find(*physicalPath);
+            jsonResource["REASON_DESCRIPTION"] =
+                guardReason != guardReasons.end() ? guardReason->second
+                                                  : "UNKNOWN";
 
             jsonResource["GUARD_RECORD"] = true;
-            ATTR_PHYS_DEV_PATH_Type phyPath;
-            if (!DT_GET_PROP(ATTR_PHYS_DEV_PATH, guardedTarget.target, phyPath))
-            {
-                jsonResource["PHYS_PATH"] = phyPath;
-            }
+            jsonResource["PHYS_PATH"] = guardedTarget->phyDevPath;
             // An error could create single PEL but multiple guard records,
             // while processing guard records do not create multiple error log
             // sections as the callout data retrieved from the PEL will be the
@@ -414,11 +272,11 @@ void GuardWithEidRecords::populate(sdbusplus::bus::bus& bus,
     }
 
     // add all the cecerrroglog json objects to the servicable event json object
-    for (const auto& pair : processedPelMap)
+    for (auto& pair : processedPelMap)
     {
         json jsonErrlogObj = json::object();
         jsonErrlogObj["CEC_ERROR_LOG"] = std::move(pair.second);
-        jsonServEvent.emplace_back(jsonErrlogObj);
+        addErrorLog(std::move(jsonErrlogObj));
     }
 }
 } // namespace openpower::faultlog
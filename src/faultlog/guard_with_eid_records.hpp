@@ -1,9 +1,13 @@
 #pragma once
 
+#include <devtree_snapshot.hpp>
 #include <libguard/include/guard_record.hpp>
+#include <logging_snapshot.hpp>
 #include <nlohmann/json.hpp>
 #include <sdbusplus/bus.hpp>
 
+#include <functional>
+
 namespace openpower::faultlog
 {
 using ::openpower::guard::GuardRecords;
@@ -29,20 +33,46 @@ class GuardWithEidRecords
      *
      *  @param[in] bus - D-Bus to attach to
      *  @param[in] guardRecords - hardware isolated records to parse
+     *  @param[in] devTree - device tree targets details
+     *  @param[in] logging - logging entries details
      *
      *  @return 0 if no records are found else count of records
      */
     static int getCount(sdbusplus::bus::bus& bus,
-                        const GuardRecords& guardRecords);
+                        const GuardRecords& guardRecords,
+                        const DevTreeSnapshot& devTree,
+                        const LoggingSnapshot& logging);
 
     /** @brief Populate permanent hardware errors to NAG json file
      *
      *  @param[in] bus - D-Bus to attach to
      *  @param[in] guardRecords - hardware isolated records to parse
+     *  @param[in] devTree - device tree targets details
+     *  @param[in] logging - logging entries details
      *  @param[in] jsonServEvent - Json capturing cec error log data
      */
     static void populate(sdbusplus::bus::bus& bus,
                          const GuardRecords& guardRecords,
+                         const DevTreeSnapshot& devTree,
+                         const LoggingSnapshot& logging,
                          nlohmann::json& jsonServEvent);
+
+    /** @brief Populate the CEC_ERROR_LOG elements one by one
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *  @param[in] guardRecords - hardware isolated records to parse
+     *  @param[in] devTree - device tree targets details
+     *  @param[in] logging - logging entries details
+     *  @param[in] addErrorLog - callback to add each CEC_ERROR_LOG element
+     *                           once it is populated
+     *
+     *  @note The elements are added after all the guard records are parsed
+     *        since the guard records of the same PEL are merged into one
+     *        element.
+     */
+    static void
+        populate(sdbusplus::bus::bus& bus, const GuardRecords& guardRecords,
+                 const DevTreeSnapshot& devTree, const LoggingSnapshot& logging,
+                 const std::function<void(nlohmann::json&&)>& addErrorLog);
 };
 } // namespace openpower::faultlog
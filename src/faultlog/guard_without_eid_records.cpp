@@ -1,11 +1,12 @@
 #include <attributes_info.H>
-#include <libphal.H>
 
 #include <guard_without_eid_records.hpp>
 #include <libguard/guard_interface.hpp>
 #include <phosphor-logging/lg2.hpp>
 #include <poweron_time.hpp>
 #include <util.hpp>
+
+#include <unordered_set>
 extern "C"
 {
 #include <libpdbg.h>
@@ -18,61 +19,6 @@ using ::nlohmann::json;
 constexpr auto stateConfigured = "CONFIGURED";
 constexpr auto stateDeconfigured = "DECONFIGURED";
 
-/** Data structure to pass to pdbg_target_traverse callback method*/
-struct GuardedWithoutEidDataList
-{
-    std::vector<pdbg_target*> targetList;
-    std::vector<std::string> pathList;
-    void addPhysicalPath(const std::string& path)
-    {
-        pathList.emplace_back(path);
-    }
-    void addPdbgTarget(pdbg_target* tgt)
-    {
-        targetList.push_back(tgt);
-    }
-};
-
-/**
- * @brief Get PDBG targets matching the phtysical path list
- *
- * This callback function is called as part of the recursive method
- * pdbg_target_traverse, recursion will exit when the method return 1
- * else continues till the target is found
- *
- * @param[in] target - pdbg target to compare
- d* @param[inout] priv - data structure to pass to the callback method
- *
- * @return 0 when all the targets are parsed
- */
-static int guardedTargets(struct pdbg_target* target, void* priv)
-{
-    // Parse through all the device tree targets recursively and
-    // check if the physical path of the target matches any of the
-    // deconfigured targets physical path if so store the target
-    // in the list.
-    //
-    // Avoiding multiple traversal through the device tree targets
-    GuardedWithoutEidDataList* deconfig =
-        reinterpret_cast<GuardedWithoutEidDataList*>(priv);
-    ATTR_PHYS_DEV_PATH_Type phyPath;
-    if (!DT_GET_PROP(ATTR_PHYS_DEV_PATH, target, phyPath))
-    {
-        for (auto& path : deconfig->pathList)
-        {
-            if (strcmp(phyPath, path.c_str()) == 0)
-            {
-                deconfig->addPdbgTarget(target);
-            }
-        }
-        if (deconfig->pathList.size() == deconfig->targetList.size())
-        {
-            return 1;
-        }
-    }
-    return 0;
-}
-
 int GuardWithoutEidRecords::getCount(const GuardRecords& guardRecords)
 {
     int count = 0;
@@ -96,6 +42,7 @@ int GuardWithoutEidRecords::getCount(const GuardRecords& guardRecords)
 }
 
 void GuardWithoutEidRecords::populate(const GuardRecords& guardRecords,
+                                      const DevTreeSnapshot& devTree,
                                       nlohmann::json& jsonNag)
 {
     try
@@ -103,7 +50,7 @@ void GuardWithoutEidRecords::populate(const GuardRecords& guardRecords,
         // capure the physical path of all the isolated/guard records
         // that does not have an errorlog object created. Those with
         // corresponding errorlog object are covered in ServiceableRecords
-        GuardedWithoutEidDataList guardList;
+        std::unordered_set<std::string> pathList;
         for (const auto& elem : guardRecords)
         {
             if (elem.elogId != 0)
@@ -119,46 +66,35 @@ void GuardWithoutEidRecords::populate(const GuardRecords& guardRecords,
                            "RECORD_ID", elem.recordId);
                 continue;
             }
-            guardList.addPhysicalPath(*physicalPath);
+            pathList.emplace(*physicalPath);
         }
+        auto guardReasons = getGuardReasons(guardRecords);
 
-        // traverse through all targets and get guarded targets list
-        pdbg_target_traverse(nullptr, guardedTargets, &guardList);
-
-        for (const auto& target : guardList.targetList)
+        // get guarded targets list from the device tree targets
+        for (const auto& targetInfo : devTree.targets())
         {
+            if (!pathList.contains(targetInfo.phyDevPath))
+            {
+                continue;
+            }
+
             json deconfigJson = json::object();
-            deconfigJson["TYPE"] = pdbgTargetName(target);
+            deconfigJson["TYPE"] = pdbgTargetName(targetInfo.target);
             std::string state = stateDeconfigured;
-            ATTR_HWAS_STATE_Type hwasState;
-            if (!DT_GET_PROP(ATTR_HWAS_STATE, target, hwasState))
+            if (targetInfo.hwasState.has_value() &&
+                targetInfo.hwasState->functional)
             {
-                if (hwasState.functional)
-                {
-                    state = stateConfigured;
-                }
+                state = stateConfigured;
             }
             deconfigJson["CURRENT_STATE"] = std::move(state);
 
-            ATTR_PHYS_DEV_PATH_Type attrPhyDevPath;
-            if (!DT_GET_PROP(ATTR_PHYS_DEV_PATH, target, attrPhyDevPath))
-            {
-                deconfigJson["PHYS_PATH"] = attrPhyDevPath;
-                deconfigJson["REASON_DESCRIPTION"] =
-                    getGuardReason(guardRecords, attrPhyDevPath);
-            }
-            else
-            {
-                // if physical path is not found do not add the record
-                // as it will be of no use
-                continue;
-            }
+            deconfigJson["PHYS_PATH"] = targetInfo.phyDevPath;
+            auto guardReason = guardReasons.find(targetInfo.phyDevPath);
+            deconfigJson["REASON_DESCRIPTION"] =
+                guardReason != guardReasons.end() ? guardReason->second
+                                                  : "UNKNOWN";
 
-            // getLocationCode checks if attr is present in target else
-            // gets it from partent target
-            ATTR_LOCATION_CODE_Type attrLocCode = {'\0'};
-            openpower::phal::pdbg::getLocationCode(target, attrLocCode);
-            deconfigJson["LOCATION_CODE"] = attrLocCode;
+            deconfigJson["LOCATION_CODE"] = targetInfo.locationCode();
 
             json header = json::object();
             header["MANUAL_ISOLATION"] = std::move(deconfigJson);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <devtree_snapshot.hpp>
 #include <libguard/include/guard_record.hpp>
 #include <nlohmann/json.hpp>
 #include <sdbusplus/bus.hpp>
@@ -33,9 +34,11 @@ class GuardWithoutEidRecords
     /** @brief Captured deconfig data in NAG JSON file
      *
      *  @param[in] guardRecords - Guard records
+     *  @param[in] devTree - device tree targets details
      *  @param[in] jsonNag - Update JSON servicable event
      */
     static void populate(const GuardRecords& guardRecords,
+                         const DevTreeSnapshot& devTree,
                          nlohmann::json& jsonNag);
 };
 } // namespace openpower::faultlog
@@ -0,0 +1,135 @@
+#include <unistd.h>
+
+#include <json_stream_writer.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace openpower::faultlog
+{
+
+constexpr auto prettyIndent = 2;
+
+JsonStreamWriter::JsonStreamWriter(int fd, bool compact) :
+    _fd(fd), _indent(compact ? -1 : prettyIndent)
+{}
+
+void JsonStreamWriter::begin()
+{
+    emit("[");
+}
+
+void JsonStreamWriter::write(const nlohmann::json& element)
+{
+    emitSeparator(_firstElement, 1);
+    _firstElement = false;
+    emitElement(element, 1);
+}
+
+void JsonStreamWriter::writeAll(const nlohmann::json& elements)
+{
+    for (const auto& element : elements)
+    {
+        write(element);
+    }
+}
+
+void JsonStreamWriter::writeSection(const std::string& name,
+                                    const nlohmann::json& elements)
+{
+    beginSection(name);
+    for (const auto& element : elements)
+    {
+        writeSectionElement(element);
+    }
+    endSection();
+}
+
+void JsonStreamWriter::beginSection(const std::string& name)
+{
+    // write {"name": [elements]} as the faultlog array element without
+    // building the section object
+    emitSeparator(_firstElement, 1);
+    _firstElement = false;
+    emit("{");
+    emitSeparator(true, 2);
+    emit(nlohmann::json(name).dump() + (_indent < 0 ? ":[" : ": ["));
+    _firstSectionElement = true;
+}
+
+void JsonStreamWriter::writeSectionElement(const nlohmann::json& element)
+{
+    emitSeparator(_firstSectionElement, 3);
+    _firstSectionElement = false;
+    emitElement(element, 3);
+}
+
+void JsonStreamWriter::endSection()
+{
+    if (!_firstSectionElement)
+    {
+        emitSeparator(true, 2);
+    }
+    emit("]");
+    emitSeparator(true, 1);
+    emit("}");
+}
+
+void JsonStreamWriter::end()
+{
+    if (!_firstElement)
+    {
+        emitSeparator(true, 0);
+    }
+    emit("]\n");
+}
+
+void JsonStreamWriter::emit(const std::string& data)
+{
+    const char* buf = data.data();
+    std::size_t remaining = data.size();
+    while (remaining > 0)
+    {
+        ssize_t written = ::write(_fd, buf, remaining);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::runtime_error(
+                std::string("Failed to write faultlog JSON output: ") +
+                strerror(errno));
+        }
+        buf += written;
+        remaining -= static_cast<std::size_t>(written);
+    }
+}
+
+void JsonStreamWriter::emitSeparator(bool first, int level)
+{
+    std::string separator = first ? "" : ",";
+    if (_indent >= 0)
+    {
+        separator += "\n" + std::string(level * _indent, ' ');
+    }
+    emit(separator);
+}
+
+void JsonStreamWriter::emitElement(const nlohmann::json& element, int level)
+{
+    std::string data = element.dump(_indent);
+    if (_indent > 0)
+    {
+        // indent the nested lines of the element as per its nesting level
+        const std::string padding(level * _indent, ' ');
+        for (auto pos = data.find('\n'); pos != std::string::npos;
+             pos = data.find('\n', pos + 1))
+        {
+            data.insert(pos + 1, padding);
+        }
+    }
+    emit(data);
+}
+} // namespace openpower::faultlog
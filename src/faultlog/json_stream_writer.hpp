@@ -0,0 +1,141 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <string>
+
+namespace openpower::faultlog
+{
+/**
+ * @class JsonStreamWriter
+ *
+ * Writes the faultlog JSON array element by element to the given file
+ * descriptor so that the whole faultlog need not to be kept in memory
+ * before writing it.
+ *
+ * The output has the same schema as the faultlog JSON array.
+ */
+class JsonStreamWriter
+{
+  public:
+    JsonStreamWriter() = delete;
+    JsonStreamWriter(const JsonStreamWriter&) = delete;
+    JsonStreamWriter& operator=(const JsonStreamWriter&) = delete;
+    JsonStreamWriter(JsonStreamWriter&&) = delete;
+    JsonStreamWriter& operator=(JsonStreamWriter&&) = delete;
+    ~JsonStreamWriter() = default;
+
+    /** @brief Constructor to write the faultlog JSON array
+     *
+     *  @param[in] fd - file descriptor to write
+     *  @param[in] compact - true to write without indentation
+     */
+    JsonStreamWriter(int fd, bool compact);
+
+    /** @brief Start the faultlog JSON array
+     *
+     *  @return void
+     */
+    void begin();
+
+    /** @brief Write an element of the faultlog JSON array
+     *
+     *  @param[in] element - JSON element to write
+     *
+     *  @return void
+     */
+    void write(const nlohmann::json& element);
+
+    /** @brief Write all the elements of the given JSON array as the
+     *         elements of the faultlog JSON array
+     *
+     *  @param[in] elements - JSON array to write
+     *
+     *  @return void
+     */
+    void writeAll(const nlohmann::json& elements);
+
+    /** @brief Write an element of the faultlog JSON array that has
+     *         the given section name and the elements as the value
+     *
+     *  @param[in] name - section name, for example, SERVICEABLE_EVENT
+     *  @param[in] elements - JSON array to write as section value
+     *
+     *  @return void
+     */
+    void writeSection(const std::string& name,
+                      const nlohmann::json& elements);
+
+    /** @brief Start an element of the faultlog JSON array that has
+     *         the given section name and the JSON array as the value
+     *
+     *  @param[in] name - section name, for example, SERVICEABLE_EVENT
+     *
+     *  @return void
+     *
+     *  @note The section elements are written by writeSectionElement()
+     *        and the section must be ended by endSection().
+     */
+    void beginSection(const std::string& name);
+
+    /** @brief Write an element of the section value JSON array
+     *
+     *  @param[in] element - JSON element to write
+     *
+     *  @return void
+     */
+    void writeSectionElement(const nlohmann::json& element);
+
+    /** @brief End the section which is started by beginSection()
+     *
+     *  @return void
+     */
+    void endSection();
+
+    /** @brief End the faultlog JSON array
+     *
+     *  @return void
+     */
+    void end();
+
+  private:
+    /** @brief File descriptor to write */
+    int _fd;
+
+    /** @brief Indentation of the JSON output, -1 for compact */
+    int _indent;
+
+    /** @brief true if no element is written in the faultlog JSON array */
+    bool _firstElement = true;
+
+    /** @brief true if no element is written in the current section */
+    bool _firstSectionElement = true;
+
+    /** @brief Write the given data to the file descriptor
+     *
+     *  @param[in] data - data to write
+     *
+     *  @return void
+     */
+    void emit(const std::string& data);
+
+    /** @brief Write the element separator and the new line with the
+     *         indentation for the given nesting level
+     *
+     *  @param[in] first - true if the first element in its array
+     *  @param[in] level - nesting level of the element
+     *
+     *  @return void
+     */
+    void emitSeparator(bool first, int level);
+
+    /** @brief Write the JSON element at the given nesting level
+     *
+     *  @param[in] element - JSON element to write
+     *  @param[in] level - nesting level of the element
+     *
+     *  @return void
+     */
+    void emitElement(const nlohmann::json& element, int level);
+};
+} // namespace openpower::faultlog
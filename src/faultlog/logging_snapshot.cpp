@@ -0,0 +1,318 @@
+#include <logging_snapshot.hpp>
+#include <phosphor-logging/lg2.hpp>
+#include <sdbusplus/exception.hpp>
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+namespace openpower::faultlog
+{
+
+using PropertyValue = LoggingSnapshot::PropertyValue;
+
+using Properties = LoggingSnapshot::Properties;
+
+using Interfaces = LoggingSnapshot::Interfaces;
+
+using Objects = std::map<sdbusplus::message::object_path, Interfaces>;
+
+/**
+ * @brief Update the logging entry from the given property if it is used
+ *
+ * @param[in] intf - interface having the property
+ * @param[in] prop - name of the property
+ * @param[in] propValue - value of the property
+ * @param[inout] entry - logging entry to update
+ */
+static void decodeProperty(const std::string& intf, const std::string& prop,
+                           const PropertyValue& propValue, LogEntry& entry)
+{
+    if (intf == "xyz.openbmc_project.Logging.Entry")
+    {
+        if (prop == "Resolved")
+        {
+            if (auto resolvedPtr = std::get_if<bool>(&propValue))
+            {
+                entry.resolved = *resolvedPtr;
+            }
+        }
+        else if (prop == "Severity")
+        {
+            if (auto severityPtr = std::get_if<std::string>(&propValue))
+            {
+                entry.severity = *severityPtr;
+            }
+        }
+        else if (prop == "Resolution")
+        {
+            if (auto calloutsPtr = std::get_if<std::string>(&propValue))
+            {
+                entry.callouts = *calloutsPtr;
+            }
+        }
+        else if (prop == "EventId")
+        {
+            if (auto eventIdPtr = std::get_if<std::string>(&propValue))
+            {
+                // EventId B700900B 00000072 00010016 ...
+                // First value is RefCode
+                std::istringstream iss(*eventIdPtr);
+                iss >> entry.refCode;
+            }
+        }
+    }
+    else if (intf == "org.open_power.Logging.PEL.Entry")
+    {
+        if (prop == "PlatformLogID")
+        {
+            if (auto plidPtr = std::get_if<uint32_t>(&propValue))
+            {
+                entry.plid = *plidPtr;
+            }
+        }
+        else if (prop == "Deconfig")
+        {
+            if (auto deconfigPtr = std::get_if<bool>(&propValue))
+            {
+                entry.deconfigured = *deconfigPtr;
+            }
+        }
+        else if (prop == "Guard")
+        {
+            if (auto guardPtr = std::get_if<bool>(&propValue))
+            {
+                entry.guarded = *guardPtr;
+            }
+        }
+        else if (prop == "Hidden")
+        {
+            if (auto hiddenPtr = std::get_if<bool>(&propValue))
+            {
+                entry.hidden = *hiddenPtr;
+            }
+        }
+        else if (prop == "Timestamp")
+        {
+            if (auto timestampPtr = std::get_if<uint64_t>(&propValue))
+            {
+                entry.timestamp = *timestampPtr;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Create the logging entry from the given interfaces of the entry
+ *
+ * @param[in] path - object path of the logging entry
+ * @param[in] interfaces - interfaces and properties of the logging entry
+ *
+ * @return logging entry
+ */
+static LogEntry decodeEntry(const sdbusplus::message::object_path& path,
+                            const Interfaces& interfaces)
+{
+    LogEntry entry;
+    entry.path = path.str;
+    try
+    {
+        entry.bmcLogId = std::stoul(path.filename());
+    }
+    catch (const std::exception& ex)
+    {
+        lg2::debug("Failed to get BMC log id from {OBJECT}", "OBJECT",
+                   path.str);
+    }
+
+    for (const auto& [intf, properties] : interfaces)
+    {
+        for (const auto& [prop, propValue] : properties)
+        {
+            decodeProperty(intf, prop, propValue, entry);
+        }
+    }
+    return entry;
+}
+
+/**
+ * @brief Get the first logging entry not ordered before the given path
+ *
+ * @param[in] entries - logging entries in the object path order
+ * @param[in] path - object path of the logging entry
+ *
+ * @return iterator to the logging entry
+ */
+static std::vector<LogEntry>::iterator
+    lowerBoundByPath(std::vector<LogEntry>& entries, const std::string& path)
+{
+    return std::lower_bound(
+        entries.begin(), entries.end(), path,
+        [](const LogEntry& entry, const std::string& entryPath) {
+        return entry.path < entryPath;
+    });
+}
+
+/**
+ * @brief Get the BMC log id of the given PEL id from the logging service
+ *
+ * @param[in] bus - D-Bus to attach to
+ * @param[in] eid - PEL id of the logging entry
+ *
+ * @return BMC log id if found else empty optional
+ */
+static std::optional<uint32_t> getBmcLogId(sdbusplus::bus::bus& bus,
+                                           uint32_t eid)
+{
+    uint32_t bmcLogId = 0;
+    try
+    {
+        auto method = bus.new_method_call(
+            "xyz.openbmc_project.Logging", "/xyz/openbmc_project/logging",
+            "org.open_power.Logging.PEL", "GetBMCLogIdFromPELId");
+
+        method.append(eid);
+        auto resp = bus.call(method);
+        resp.read(bmcLogId);
+    }
+    catch (const sdbusplus::exception::SdBusError& ex)
+    {
+        return std::nullopt;
+    }
+    return bmcLogId;
+}
+
+LoggingSnapshot::LoggingSnapshot(sdbusplus::bus::bus& bus)
+{
+    try
+    {
+        Objects objects;
+        auto method = bus.new_method_call(
+            "xyz.openbmc_project.Logging", "/xyz/openbmc_project/logging",
+            "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        auto reply = bus.call(method);
+        reply.read(objects);
+
+        _entries.reserve(objects.size());
+        for (const auto& [path, interfaces] : objects)
+        {
+            if (!interfaces.contains("xyz.openbmc_project.Logging.Entry"))
+            {
+                // not a logging entry, for example, the logging collection
+                continue;
+            }
+
+            _entries.push_back(decodeEntry(path, interfaces));
+        }
+        reindex();
+    }
+    catch (const sdbusplus::exception::SdBusError& ex)
+    {
+        lg2::info("There are no PELS or failed to get the logging "
+                  "entries {ERROR}",
+                  "ERROR", ex);
+    }
+}
+
+void LoggingSnapshot::addEntry(const std::string& path,
+                               const Interfaces& interfaces)
+{
+    if (!interfaces.contains("xyz.openbmc_project.Logging.Entry"))
+    {
+        return;
+    }
+
+    // keep the entries in the logging object path order
+    auto it = lowerBoundByPath(_entries, path);
+    auto entry = decodeEntry(sdbusplus::message::object_path(path),
+                             interfaces);
+    if ((it != _entries.end()) && (it->path == path))
+    {
+        *it = std::move(entry);
+    }
+    else
+    {
+        _entries.insert(it, std::move(entry));
+    }
+    reindex();
+}
+
+void LoggingSnapshot::removeEntry(const std::string& path)
+{
+    auto it = lowerBoundByPath(_entries, path);
+    if ((it == _entries.end()) || (it->path != path))
+    {
+        return;
+    }
+    _entries.erase(it);
+    reindex();
+}
+
+void LoggingSnapshot::updateEntry(const std::string& path,
+                                  const std::string& intf,
+                                  const Properties& properties)
+{
+    auto it = lowerBoundByPath(_entries, path);
+    if ((it == _entries.end()) || (it->path != path))
+    {
+        return;
+    }
+    for (const auto& [prop, propValue] : properties)
+    {
+        decodeProperty(intf, prop, propValue, *it);
+    }
+}
+
+void LoggingSnapshot::reindex()
+{
+    _entriesByBmcLogId.clear();
+    for (std::size_t index = 0; index < _entries.size(); ++index)
+    {
+        // keep the first entry if the same BMC log id is found again
+        _entriesByBmcLogId.emplace(_entries[index].bmcLogId, index);
+    }
+}
+
+const LogEntry* LoggingSnapshot::findByBmcLogId(uint32_t bmcLogId) const
+{
+    auto it = _entriesByBmcLogId.find(bmcLogId);
+    if (it == _entriesByBmcLogId.end())
+    {
+        return nullptr;
+    }
+    return &_entries[it->second];
+}
+
+const LogEntry* LoggingSnapshot::findByEid(sdbusplus::bus::bus& bus,
+                                           uint32_t eid) const
+{
+    std::optional<uint32_t> bmcLogId;
+    auto prefetched = _bmcLogIdsByEid.find(eid);
+    if (prefetched != _bmcLogIdsByEid.end())
+    {
+        bmcLogId = prefetched->second;
+    }
+    else
+    {
+        bmcLogId = getBmcLogId(bus, eid);
+    }
+
+    if (!bmcLogId.has_value())
+    {
+        return nullptr;
+    }
+    return findByBmcLogId(*bmcLogId);
+}
+
+void LoggingSnapshot::prefetchEids(sdbusplus::bus::bus& bus,
+                                   const std::vector<uint32_t>& eids)
+{
+    for (const auto& eid : eids)
+    {
+        if (!_bmcLogIdsByEid.contains(eid))
+        {
+            _bmcLogIdsByEid.emplace(eid, getBmcLogId(bus, eid));
+        }
+    }
+}
+} // namespace openpower::faultlog
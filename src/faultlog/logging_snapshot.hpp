@@ -0,0 +1,161 @@
+#pragma once
+
+#include <sdbusplus/bus.hpp>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace openpower::faultlog
+{
+/**
+ * @brief Logging entry properties used by the faultlog sections
+ */
+struct LogEntry
+{
+    std::string path;
+    uint32_t bmcLogId = 0;
+
+    // xyz.openbmc_project.Logging.Entry
+    bool resolved = true;
+    std::string severity =
+        "xyz.openbmc_project.Logging.Entry.Level.Informational";
+    std::string callouts;
+    std::string refCode;
+
+    // org.open_power.Logging.PEL.Entry
+    uint32_t plid = 0;
+    bool deconfigured = false;
+    bool guarded = false;
+    bool hidden = false;
+    uint64_t timestamp = 0;
+};
+
+/**
+ * @class LoggingSnapshot
+ *
+ * Captures the logging entries by a single GetManagedObjects call on the
+ * logging service and keeps only the properties used by the faultlog
+ * sections so that all the sections can use it instead of reading the
+ * logging entries on their own.
+ *
+ * The captured entries can be kept up to date from the logging signals
+ * by the long running faultlog daemon.
+ */
+class LoggingSnapshot
+{
+  public:
+    using PropertyValue =
+        std::variant<std::string, bool, uint8_t, int16_t, uint16_t, int32_t,
+                     uint32_t, int64_t, uint64_t, double>;
+    using Properties = std::map<std::string, PropertyValue>;
+    using Interfaces = std::map<std::string, Properties>;
+
+    LoggingSnapshot() = delete;
+    LoggingSnapshot(const LoggingSnapshot&) = delete;
+    LoggingSnapshot& operator=(const LoggingSnapshot&) = delete;
+    LoggingSnapshot(LoggingSnapshot&&) = delete;
+    LoggingSnapshot& operator=(LoggingSnapshot&&) = delete;
+    ~LoggingSnapshot() = default;
+
+    /** @brief Read and capture all the logging entries
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *
+     *  @note The snapshot will be empty if failed to read the logging
+     *        entries.
+     */
+    explicit LoggingSnapshot(sdbusplus::bus::bus& bus);
+
+    /** @brief Get the logging entry for the given BMC log id
+     *
+     *  @param[in] bmcLogId - BMC log id of the logging entry
+     *
+     *  @return logging entry if found else nullptr
+     */
+    const LogEntry* findByBmcLogId(uint32_t bmcLogId) const;
+
+    /** @brief Get the logging entry for the given PEL id (aka EID)
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *  @param[in] eid - PEL id of the logging entry
+     *
+     *  @return logging entry if found else nullptr
+     *
+     *  @note The PEL id is not part of the logging entry properties so,
+     *        the BMC log id is got from the logging service if not
+     *        prefetched.
+     */
+    const LogEntry* findByEid(sdbusplus::bus::bus& bus, uint32_t eid) const;
+
+    /** @brief Get and keep the BMC log id of the given PEL ids so that
+     *         findByEid need not to call the logging service
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *  @param[in] eids - PEL ids to prefetch
+     *
+     *  @return NULL
+     */
+    void prefetchEids(sdbusplus::bus::bus& bus,
+                      const std::vector<uint32_t>& eids);
+
+    /** @brief Get all the captured logging entries
+     *
+     *  @return logging entries in the logging object path order
+     */
+    const std::vector<LogEntry>& entries() const
+    {
+        return _entries;
+    }
+
+    /** @brief Add or replace the logging entry of the given object path
+     *
+     *  @param[in] path - object path of the logging entry
+     *  @param[in] interfaces - interfaces and properties of the entry
+     *
+     *  @return NULL
+     *
+     *  @note Ignored if the object is not a logging entry.
+     */
+    void addEntry(const std::string& path, const Interfaces& interfaces);
+
+    /** @brief Remove the logging entry of the given object path
+     *
+     *  @param[in] path - object path of the logging entry
+     *
+     *  @return NULL
+     */
+    void removeEntry(const std::string& path);
+
+    /** @brief Update the changed properties of the logging entry
+     *
+     *  @param[in] path - object path of the logging entry
+     *  @param[in] intf - interface having the changed properties
+     *  @param[in] properties - changed properties
+     *
+     *  @return NULL
+     */
+    void updateEntry(const std::string& path, const std::string& intf,
+                     const Properties& properties);
+
+  private:
+    /** @brief Captured logging entries */
+    std::vector<LogEntry> _entries;
+
+    /** @brief Index of the captured logging entries by the BMC log id */
+    std::unordered_map<uint32_t, std::size_t> _entriesByBmcLogId;
+
+    /** @brief Prefetched BMC log id by the PEL id, empty if not found */
+    std::unordered_map<uint32_t, std::optional<uint32_t>> _bmcLogIdsByEid;
+
+    /** @brief Rebuild the BMC log id index of the captured entries
+     *
+     *  @return NULL
+     */
+    void reindex();
+};
+} // namespace openpower::faultlog
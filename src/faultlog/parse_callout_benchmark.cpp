@@ -0,0 +1,248 @@
+#include <nlohmann/json.hpp>
+#include <util.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using ::nlohmann::json;
+
+namespace
+{
+
+/**
+ * @brief The std::regex based parser which is replaced by the tokenizer,
+ *        kept as it is to check the parity.
+ * @param[in] callout - callouts string
+ *
+ * @return Json object as per NAG specification for callouts
+ */
+json regexParseCallout(const std::string callout)
+{
+    if (callout.empty())
+    {
+        return json::object();
+    }
+    std::istringstream stream(callout);
+    std::string line;
+
+    std::regex pattern(
+        R"((Location Code|Priority|PN|SN|CCIN):\s*([A-Za-z0-9.-]+))");
+
+    int lineCount = 0;
+    json calloutsJson = json::array();
+    while (std::getline(stream, line))
+    {
+        if (!line.empty())
+        {
+            lineCount += 1;
+            json jsonObject;
+            std::smatch matches;
+            std::string::const_iterator searchStart(line.cbegin());
+
+            while (
+                std::regex_search(searchStart, line.cend(), matches, pattern))
+            {
+                std::string key = matches[1].str();
+                if (key == "SN")
+                {
+                    key = "Serial Number";
+                }
+                else if (key == "PN")
+                {
+                    key = "Part Number";
+                }
+                jsonObject[key] = matches[2].str();
+                searchStart = matches.suffix().first;
+            }
+            calloutsJson.push_back(jsonObject);
+        }
+    }
+    json sectionJson = json::object();
+    sectionJson["Callout Count"] = lineCount;
+    sectionJson["Callouts"] = calloutsJson;
+    return sectionJson;
+}
+
+/**
+ * @brief The logging Resolution property values which are seen on
+ *        the systems (hardware, procedure and symbolic FRU callouts)
+ *        and the corner cases of the parsing rules.
+ */
+const std::vector<std::string> calloutSamples{
+    "1. Location Code: U78DA.ND0.WZS004K-P0-C15, Priority: H, "
+    "PN: 02WG676, SN: YL30UF18Y0F5, CCIN: 2E2D\n",
+    "1. Location Code: U78DA.ND0.WZS004K-P0-C15-C1, Priority: H, "
+    "PN: 03KP537, SN: YA3936064213, CCIN: 32BB\n"
+    "2. Location Code: U78DA.ND0.WZS004K-P0-C15, Priority: M, "
+    "PN: 02WG676, SN: YL30UF18Y0F5, CCIN: 2E2D\n"
+    "3. Priority: L, Procedure: BMC0001\n",
+    "1. Priority: H, Procedure: BMC0003\n"
+    "2. Priority: M, Symbolic FRU: SVCDOCS\n",
+    "1. Location Code: U78DA.ND0.WZS004K-P0-C12, Priority: H, "
+    "Symbolic FRU: SYSBKPL, Trusted Location Code\n",
+    "1. Location Code: U78DA.ND0.WZS004K-P0-C15-C1-C0, Priority: H, "
+    "PN: 78P6815, SN: YH3016T2Z03N, CCIN: 324D\n"
+    "\n"
+    "2. Location Code: U78DA.ND0.WZS004K-P0-C15-C1, Priority: A, "
+    "PN: 03KP537, SN: YA3936064213, CCIN: 32BB\n",
+    "1. Location Code:U78DA.ND0.WZS004K-P0-C15,Priority:H,PN:02WG676\r\n"
+    "2. SPN: X1, LPriority: M, CCIN:\t2E2D, SN: , PN:\n"
+    "3. Location Code: , Location Code: Ux-P0\n",
+    "No callouts",
+};
+
+/**
+ * @brief The deterministic fuzzer to generate the callout lines from
+ *        the tokens which hit the parsing rules.
+ */
+class CalloutFuzzer
+{
+  public:
+    std::string next()
+    {
+        static constexpr std::array<std::string_view, 22> tokens{
+            "Location Code", "Location", "Code", "Priority", "PN",
+            "SN",            "CCIN",     "SPN",  ":",        ": ",
+            ":\t",           ", ",       " ",    "\n",       "\r",
+            "U78DA.ND0",     "-P0-C15",  "H",    "02WG676",  "_",
+            "1. ",           "/"};
+
+        std::string callout;
+        auto count = nextRandom() % 24;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            callout += tokens[nextRandom() % tokens.size()];
+        }
+        return callout;
+    }
+
+  private:
+    uint64_t _state{0x2545f4914f6cdd1dULL};
+
+    uint32_t nextRandom()
+    {
+        _state = (_state * 6364136223846793005ULL) + 1442695040888963407ULL;
+        return static_cast<uint32_t>(_state >> 33);
+    }
+};
+
+/**
+ * @brief Used to keep the parsed output from being optimized out
+ */
+volatile std::size_t parsedSink = 0;
+
+/**
+ * @brief Check whether both parsers are giving the same output
+ * @param[in] callout - callouts string
+ *
+ * @return true if same else false
+ */
+bool checkParity(const std::string& callout)
+{
+    auto expected = regexParseCallout(callout);
+    auto actual = openpower::faultlog::parseCallout(callout);
+    if (expected == actual)
+    {
+        return true;
+    }
+    std::cerr << "Mismatch for the callout [" << json(callout).dump()
+              << "]\n  regex: " << expected.dump()
+              << "\n  tokenizer: " << actual.dump() << std::endl;
+    return false;
+}
+
+/**
+ * @brief Get the average time of the given parser over the samples
+ * @param[in] parser - parser to measure
+ * @param[in] iterations - number of times to parse all the samples
+ *
+ * @return average nanoseconds per callout
+ */
+template <typename Parser>
+double measure(Parser&& parser, const uint32_t iterations)
+{
+    std::size_t parsedCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        for (const auto& callout : calloutSamples)
+        {
+            parsedCount += parser(callout).size();
+        }
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start);
+    parsedSink = parsedCount;
+    return elapsed.count() /
+           (static_cast<double>(iterations) * calloutSamples.size());
+}
+
+} // namespace
+
+/**
+ * Checks the parity of the tokenizer based parseCallout against the
+ * replaced std::regex based parser on the real callout samples and the
+ * fuzzed callouts, and reports the time of both the parsers.
+ *
+ * Usage: parse-callout-benchmark [iterations] [fuzz count]
+ */
+int main(int argc, char** argv)
+{
+    uint32_t iterations = 2000;
+    uint32_t fuzzCount = 100000;
+    if (argc > 1)
+    {
+        iterations = std::strtoul(argv[1], nullptr, 10);
+    }
+    if (argc > 2)
+    {
+        fuzzCount = std::strtoul(argv[2], nullptr, 10);
+    }
+
+    bool parity = true;
+    for (const auto& callout : calloutSamples)
+    {
+        parity = checkParity(callout) && parity;
+    }
+
+    CalloutFuzzer fuzzer;
+    for (uint32_t i = 0; i < fuzzCount; i++)
+    {
+        parity = checkParity(fuzzer.next()) && parity;
+    }
+
+    if (!parity)
+    {
+        std::cerr << "The tokenizer output is not same as the regex output"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Parity passed for " << calloutSamples.size()
+              << " samples and " << fuzzCount << " fuzzed callouts"
+              << std::endl;
+
+    if (iterations == 0)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    auto regexTime = measure(regexParseCallout, iterations);
+    auto tokenizerTime =
+        measure(openpower::faultlog::parseCallout, iterations);
+    std::cout << "regex: " << regexTime << " ns/callout" << std::endl;
+    std::cout << "tokenizer: " << tokenizerTime << " ns/callout" << std::endl;
+    if (tokenizerTime > 0)
+    {
+        std::cout << "speedup: " << (regexTime / tokenizerTime) << "x"
+                  << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
@@ -8,8 +8,6 @@
 
 namespace openpower::faultlog
 {
-constexpr auto poweronTimeFile =
-    "/var/lib/op-hw-isolation/persistdata/powerontime";
 using namespace std::chrono;
 using Severity = sdbusplus::xyz::openbmc_project::Logging::server::Entry::Level;
 
@@ -3,6 +3,9 @@
 
 namespace openpower::faultlog
 {
+constexpr auto poweronTimeFile =
+    "/var/lib/op-hw-isolation/persistdata/powerontime";
+
 /**
  * @brief Return time in BCD from milliSeconds since epoch time
  * @param[in] milliSeconds - milli seconds since epoch time
@@ -1,11 +1,12 @@
 #include <attributes_info.H>
-#include <libphal.H>
 
 #include <libguard/guard_interface.hpp>
 #include <phosphor-logging/log.hpp>
 #include <poweron_time.hpp>
 #include <unresolved_pels.hpp>
 #include <util.hpp>
+
+#include <unordered_map>
 extern "C"
 {
 #include <libpdbg.h>
@@ -15,193 +16,58 @@ namespace openpower::faultlog
 {
 using ::nlohmann::json;
 
-using PropertyValue =
-    std::variant<std::string, bool, uint8_t, int16_t, uint16_t, int32_t,
-                 uint32_t, int64_t, uint64_t, double>;
-
-using Properties = std::map<std::string, PropertyValue>;
-
-using Interfaces = std::map<std::string, Properties>;
-
-using Objects = std::map<sdbusplus::message::object_path, Interfaces>;
-
 constexpr auto stateConfigured = "CONFIGURED";
 constexpr auto stateDeconfigured = "DECONFIGURED";
 constexpr std::string pwrThermalErrPrefix = "1100";
 constexpr auto chassisPwnOnStartedErrSrc = "BD8D3416";
 
-struct GuardedTarget
-{
-    pdbg_target* target = nullptr;
-    std::string phyDevPath;
-    GuardedTarget(const std::string& path) : phyDevPath(path) {}
-};
-
-/**
- * @brief Get PDBG target matching the guarded target physicalpath
- *
- * This callback function is called as part of the recursive method
- * pdbg_target_traverse, recursion will exit when the method return 1
- * else continues till the target is found
- *
- * @param[in] target - pdbg target to compare
- * @param[inout] priv - data structure passed to the callback method
- *
- * @return 1 when target is found else 0
- */
-static int getGuardedTarget(struct pdbg_target* target, void* priv)
-{
-    // recursive callback function that exits when the target matching the
-    // guarded targets physical path is found in the device tree.
-    // to exit the recursive function return 1 to continue return 0
-    GuardedTarget* guardTarget = reinterpret_cast<GuardedTarget*>(priv);
-    ATTR_PHYS_DEV_PATH_Type phyPath;
-    if (!DT_GET_PROP(ATTR_PHYS_DEV_PATH, target, phyPath))
-    {
-        if (strcmp(phyPath, guardTarget->phyDevPath.c_str()) == 0)
-        {
-            guardTarget->target = target;
-            return 1;
-        }
-    }
-    return 0;
-}
-
-int UnresolvedPELs::getCount(sdbusplus::bus::bus& bus, bool ignorePwrFanPel)
+int UnresolvedPELs::getCount(sdbusplus::bus::bus& bus,
+                             const LoggingSnapshot& logging,
+                             bool ignorePwrFanPel)
 {
     int count = 0;
     try
     {
-        Objects objects;
-        auto method = bus.new_method_call(
-            "xyz.openbmc_project.Logging", "/xyz/openbmc_project/logging",
-            "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
-        auto reply = bus.call(method);
-        reply.read(objects);
-
         // read timestamp from file
         uint64_t poweronTimestamp = readPowerOnTime(bus);
 
-        for (const auto& [path, interfaces] : objects)
+        for (const auto& entry : logging.entries())
         {
-            bool resolved = true;
-            std::string severity =
-                "xyz.openbmc_project.Logging.Entry.Level.Informational";
-            bool deconfigured = false;
-            bool guarded = false;
-            bool hidden = false;
-            std::string refCode;
-            uint64_t timestamp = 0;
-            for (const auto& [intf, properties] : interfaces)
-            {
-                if (intf == "xyz.openbmc_project.Logging.Entry")
-                {
-                    for (const auto& [prop, propValue] : properties)
-                    {
-                        if (prop == "Resolved")
-                        {
-                            auto resolvedPtr = std::get_if<bool>(&propValue);
-                            if (resolvedPtr != nullptr)
-                            {
-                                resolved = *resolvedPtr;
-                            }
-                        }
-                        else if (prop == "Severity")
-                        {
-                            auto severityPtr =
-                                std::get_if<std::string>(&propValue);
-                            if (severityPtr != nullptr)
-                            {
-                                severity = *severityPtr;
-                            }
-                        }
-                        else if (prop == "EventId")
-                        {
-                            auto eventIdPtr =
-                                std::get_if<std::string>(&propValue);
-                            if (eventIdPtr != nullptr)
-                            {
-                                // EventId B700900B 00000072 00010016 ...
-                                // First value is RefCode
-                                std::istringstream iss(*eventIdPtr);
-                                iss >> refCode;
-                            }
-                        }
-                    }
-                }
-                else if (intf == "org.open_power.Logging.PEL.Entry")
-                {
-                    for (const auto& [prop, propValue] : properties)
-                    {
-                        if (prop == "Deconfig")
-                        {
-                            auto deconfigPtr = std::get_if<bool>(&propValue);
-                            if (deconfigPtr != nullptr)
-                            {
-                                deconfigured = *deconfigPtr;
-                            }
-                        }
-                        else if (prop == "Hidden")
-                        {
-                            auto hiddenPtr = std::get_if<bool>(&propValue);
-                            if (hiddenPtr != nullptr)
-                            {
-                                hidden = *hiddenPtr;
-                            }
-                        }
-                        else if (prop == "Guard")
-                        {
-                            auto guardPtr = std::get_if<bool>(&propValue);
-                            if (guardPtr != nullptr)
-                            {
-                                guarded = *guardPtr;
-                            }
-                        }
-                        else if (prop == "Timestamp")
-                        {
-                            auto timestampPtr =
-                                std::get_if<uint64_t>(&propValue);
-                            if (timestampPtr != nullptr)
-                            {
-                                timestamp = *timestampPtr;
-                            }
-                        }
-                    }
-                }
-            }
-
-            if (resolved == true)
+            if (entry.resolved == true)
             {
                 continue;
             }
 
             // ignore informational and debug errors
-            if ((severity == "xyz.openbmc_project.Logging.Entry.Level.Debug") ||
-                (severity ==
+            if ((entry.severity ==
+                 "xyz.openbmc_project.Logging.Entry.Level.Debug") ||
+                (entry.severity ==
                  "xyz.openbmc_project.Logging.Entry.Level.Informational") ||
-                (severity == "xyz.openbmc_project.Logging.Entry.Level.Notice"))
+                (entry.severity ==
+                 "xyz.openbmc_project.Logging.Entry.Level.Notice"))
             {
                 continue;
             }
 
-            if (deconfigured == false)
+            if (entry.deconfigured == false)
             {
                 continue;
             }
 
-            if (hidden == true)
+            if (entry.hidden == true)
             {
                 continue;
             }
 
-            if (guarded == true) // will be captured as part of guard records
+            // will be captured as part of guard records
+            if (entry.guarded == true)
             {
                 continue;
             }
 
             // power and thermal err src starts with 1100
             bool pwrThermalErr = false;
-            if (refCode.substr(0, pwrThermalErrPrefix.length()) ==
+            if (entry.refCode.substr(0, pwrThermalErrPrefix.length()) ==
                 pwrThermalErrPrefix)
             {
                 pwrThermalErr = true;
@@ -212,7 +78,7 @@ int UnresolvedPELs::getCount(sdbusplus::bus::bus& bus, bool ignorePwrFanPel)
             {
                 lg2::info("Ignoring power/thermal PEL as system is IPLing "
                           "{OBJECT}",
-                          "OBJECT", path.str);
+                          "OBJECT", entry.path);
                 continue;
             }
 
@@ -221,12 +87,12 @@ int UnresolvedPELs::getCount(sdbusplus::bus::bus& bus, bool ignorePwrFanPel)
             {
                 lg2::info("Ignoring power/thermal PEL as poweron timestamp "
                           "is not found {OBJECT}",
-                          "OBJECT", path.str);
+                          "OBJECT", entry.path);
                 continue;
             }
 
             // Ignore PELS that are created before chassis poweron
-            if (timestamp < poweronTimestamp)
+            if (entry.timestamp < poweronTimestamp)
             {
                 continue;
             }
@@ -250,158 +116,81 @@ int UnresolvedPELs::getCount(sdbusplus::bus::bus& bus, bool ignorePwrFanPel)
 }
 
 void UnresolvedPELs::populate(sdbusplus::bus::bus& bus,
-                              const GuardRecords& guardRecords, json& jsonNag)
+                              const GuardRecords& guardRecords,
+                              const DevTreeSnapshot& devTree,
+                              const LoggingSnapshot& logging, json& jsonNag)
+{
+    populate(bus, guardRecords, devTree, logging, [&jsonNag](json&& errorLog) {
+        jsonNag.emplace_back(std::move(errorLog));
+    });
+}
+
+void UnresolvedPELs::populate(
+    sdbusplus::bus::bus& bus, const GuardRecords& guardRecords,
+    const DevTreeSnapshot& devTree, const LoggingSnapshot& logging,
+    const std::function<void(json&&)>& addErrorLog)
 {
     try
     {
-        Objects objects;
-        auto method = bus.new_method_call(
-            "xyz.openbmc_project.Logging", "/xyz/openbmc_project/logging",
-            "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
-        auto reply = bus.call(method);
-        reply.read(objects);
-
         uint64_t poweronTimestamp = readPowerOnTime(bus);
 
-        for (const auto& [path, interfaces] : objects)
+        // guarded targets physical path by the error log id of the guard
+        // records and the guard reason by the physical path to avoid
+        // parsing all the guard records for each PEL
+        std::unordered_map<uint32_t,
+                           std::vector<std::pair<uint32_t, std::string>>>
+            guardedPathsByElogId;
+        for (const auto& elem : guardRecords)
         {
-            bool resolved = true;
-            std::string severity =
-                "xyz.openbmc_project.Logging.Entry.Level.Informational";
-            uint32_t plid = 0;
-            bool deconfigured = false;
-            bool guarded = false;
-            bool hidden = false;
-            uint64_t timestamp = 0;
-            std::string callouts;
-            std::string refCode;
-            for (const auto& [intf, properties] : interfaces)
+            auto physicalPath =
+                openpower::guard::getPhysicalPath(elem.targetId);
+            if (!physicalPath.has_value())
             {
-                if (intf == "xyz.openbmc_project.Logging.Entry")
-                {
-                    for (const auto& [prop, propValue] : properties)
-                    {
-                        if (prop == "Resolved")
-                        {
-                            auto resolvedPtr = std::get_if<bool>(&propValue);
-                            if (resolvedPtr != nullptr)
-                            {
-                                resolved = *resolvedPtr;
-                            }
-                        }
-                        else if (prop == "Severity")
-                        {
-                            auto severityPtr =
-                                std::get_if<std::string>(&propValue);
-                            if (severityPtr != nullptr)
-                            {
-                                severity = *severityPtr;
-                            }
-                        }
-                        else if (prop == "Resolution")
-                        {
-                            auto calloutsPtr =
-                                std::get_if<std::string>(&propValue);
-                            if (calloutsPtr != nullptr)
-                            {
-                                callouts = *calloutsPtr;
-                            }
-                        }
-                        else if (prop == "EventId")
-                        {
-                            auto eventIdPtr =
-                                std::get_if<std::string>(&propValue);
-                            if (eventIdPtr != nullptr)
-                            {
-                                // EventId B700900B 00000072 ...
-                                // First value is RefCode
-                                std::istringstream iss(*eventIdPtr);
-                                iss >> refCode;
-                            }
-                        }
-                    }
-                }
-                else if (intf == "org.open_power.Logging.PEL.Entry")
-                {
-                    for (const auto& [prop, propValue] : properties)
-                    {
-                        if (prop == "PlatformLogID")
-                        {
-                            auto plidPtr = std::get_if<uint32_t>(&propValue);
-                            if (plidPtr != nullptr)
-                            {
-                                plid = *plidPtr;
-                            }
-                        }
-                        else if (prop == "Deconfig")
-                        {
-                            auto deconfigPtr = std::get_if<bool>(&propValue);
-                            if (deconfigPtr != nullptr)
-                            {
-                                deconfigured = *deconfigPtr;
-                            }
-                        }
-                        else if (prop == "Guard")
-                        {
-                            auto guardPtr = std::get_if<bool>(&propValue);
-                            if (guardPtr != nullptr)
-                            {
-                                guarded = *guardPtr;
-                            }
-                        }
-                        else if (prop == "Timestamp")
-                        {
-                            auto timestampPtr =
-                                std::get_if<uint64_t>(&propValue);
-                            if (timestampPtr != nullptr)
-                            {
-                                timestamp = *timestampPtr;
-                            }
-                        }
-                        else if (prop == "Hidden")
-                        {
-                            auto hiddenPtr = std::get_if<bool>(&propValue);
-                            if (hiddenPtr != nullptr)
-                            {
-                                hidden = *hiddenPtr;
-                            }
-                        }
-                    }
-                }
+                lg2::error("Failed to get physical path for record {RECORD_ID}",
+                           "RECORD_ID", elem.recordId);
+                continue;
             }
+            guardedPathsByElogId[elem.elogId].emplace_back(elem.recordId,
+                                                           *physicalPath);
+        }
+        auto guardReasons = getGuardReasons(guardRecords);
 
-            if (resolved == true)
+        for (const auto& entry : logging.entries())
+        {
+            if (entry.resolved == true)
             {
                 continue;
             }
 
             // ignore informational and debug errors
-            if ((severity == "xyz.openbmc_project.Logging.Entry.Level.Debug") ||
-                (severity == "xyz.openbmc_project.Logging.Entry.Level."
-                             "Informational") ||
-                (severity == "xyz.openbmc_project.Logging.Entry.Level.Notice"))
+            if ((entry.severity ==
+                 "xyz.openbmc_project.Logging.Entry.Level.Debug") ||
+                (entry.severity == "xyz.openbmc_project.Logging.Entry.Level."
+                                   "Informational") ||
+                (entry.severity ==
+                 "xyz.openbmc_project.Logging.Entry.Level.Notice"))
             {
                 continue;
             }
 
-            if (deconfigured == false)
+            if (entry.deconfigured == false)
             {
                 continue;
             }
 
-            if (guarded == true)
+            if (entry.guarded == true)
             {
                 continue; // will be captured as part of guard records
             }
 
-            if (hidden == true)
+            if (entry.hidden == true)
             {
                 continue;
             }
 
             // power and thermal err src starts with 1100
             bool pwrThermalErr = false;
-            if (refCode.substr(0, pwrThermalErrPrefix.length()) ==
+            if (entry.refCode.substr(0, pwrThermalErrPrefix.length()) ==
                 pwrThermalErrPrefix)
             {
                 pwrThermalErr = true;
@@ -412,91 +201,80 @@ void UnresolvedPELs::populate(sdbusplus::bus::bus& bus,
             {
                 lg2::debug("Ignoring power/thermal PEL as poweron timestamp "
                            "is not found {OBJECT}",
-                           "OBJECT", path.str);
+                           "OBJECT", entry.path);
                 continue;
             }
 
             // Ignore PELS that are created before chassis poweron
-            if (timestamp < poweronTimestamp)
+            if (entry.timestamp < poweronTimestamp)
             {
                 lg2::debug("Ignoring PEL created before chassis "
                            "poweron {OBJECT}",
-                           "OBJECT", path.str);
+                           "OBJECT", entry.path);
                 continue;
             }
 
             // add cec errorlog
             json jsonErrorLog = json::object();
             std::stringstream ss;
-            ss << std::hex << "0x" << plid;
+            ss << std::hex << "0x" << entry.plid;
             jsonErrorLog["PLID"] = ss.str();
-            jsonErrorLog["Callout Section"] = parseCallout(callouts);
-            jsonErrorLog["SRC"] = refCode;
-            jsonErrorLog["DATE_TIME"] = epochTimeToBCD(timestamp);
+            jsonErrorLog["Callout Section"] = parseCallout(entry.callouts);
+            jsonErrorLog["SRC"] = entry.refCode;
+            jsonErrorLog["DATE_TIME"] = epochTimeToBCD(entry.timestamp);
 
             json jsonErrorLogSection = json::array();
             jsonErrorLogSection.push_back(std::move(jsonErrorLog));
 
             // add resource action check if guard record is found
             json jsonResource = json::object();
-            for (const auto& elem : guardRecords)
+            auto guardedPaths = guardedPathsByElogId.find(entry.plid);
+            if (guardedPaths != guardedPathsByElogId.end())
             {
-                if (elem.elogId == plid)
+                for (const auto& [recordId, physicalPath] :
+                     guardedPaths->second)
                 {
-                    auto physicalPath =
-                        openpower::guard::getPhysicalPath(elem.targetId);
-                    GuardedTarget guardedTarget(*physicalPath);
-                    pdbg_target_traverse(nullptr, getGuardedTarget,
-                                         &guardedTarget);
-                    if (guardedTarget.target == nullptr)
+                    const TargetInfo* guardedTarget =
+                        devTree.find(physicalPath);
+                    if (guardedTarget == nullptr)
                     {
                         lg2::info("Failed to find the pdbg target for "
                                   "guarded "
                                   "target {RECORD_ID}",
-                                  "RECORD_ID", elem.recordId);
+                                  "RECORD_ID", recordId);
                         continue;
                     }
-                    jsonResource["TYPE"] = pdbgTargetName(guardedTarget.target);
+                    jsonResource["TYPE"] =
+                        pdbgTargetName(guardedTarget->target);
                     std::string state = stateDeconfigured;
-                    ATTR_HWAS_STATE_Type hwasState;
-                    if (!DT_GET_PROP(ATTR_HWAS_STATE, guardedTarget.target,
-                                     hwasState))
+                    if (guardedTarget->hwasState.has_value() &&
+                        guardedTarget->hwasState->functional)
                     {
-                        if (hwasState.functional)
-                        {
-                            state = stateConfigured;
-                        }
+                        state = stateConfigured;
                     }
                     jsonResource["CURRENT_STATE"] = std::move(state);
 
-                    // getLocationCode checks if attr is present in target else
-                    // gets it from partent target
-                    ATTR_LOCATION_CODE_Type attrLocCode = {'\0'};
-                    openpower::phal::pdbg::getLocationCode(guardedTarget.target,
-                                                           attrLocCode);
-                    jsonResource["LOCATION_CODE"] = attrLocCode;
+                    jsonResource["LOCATION_CODE"] =
+                        guardedTarget->locationCode();
 
+                    auto guardReason = guardReasons.find(physicalPath);
                     jsonResource["REASON_DESCRIPTION"] =
-                        getGuardReason(guardRecords, *physicalPath);
+                        guardReason != guardReasons.end() ? guardReason->second
+                                                          : "UNKNOWN";
 
                     jsonResource["GUARD_RECORD"] = true;
-                    ATTR_PHYS_DEV_PATH_Type phyPath;
-                    if (!DT_GET_PROP(ATTR_PHYS_DEV_PATH, guardedTarget.target,
-                                     phyPath))
-                    {
-                        jsonResource["PHYS_PATH"] = phyPath;
-                    }
+                    jsonResource["PHYS_PATH"] = guardedTarget->phyDevPath;
 
                     break;
                 }
-            } // endfor
+            }
             json jsonEventData = json::object();
             jsonEventData["RESOURCE_ACTIONS"] = std::move(jsonResource);
             jsonErrorLogSection.push_back(jsonEventData);
 
             json jsonErrlogObj = json::object();
             jsonErrlogObj["CEC_ERROR_LOG"] = std::move(jsonErrorLogSection);
-            jsonNag.emplace_back(jsonErrlogObj);
+            addErrorLog(std::move(jsonErrlogObj));
         }
     }
     catch (const sdbusplus::exception::SdBusError& ex)
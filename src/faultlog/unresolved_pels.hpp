@@ -1,9 +1,13 @@
 #pragma once
 
+#include <devtree_snapshot.hpp>
 #include <libguard/include/guard_record.hpp>
+#include <logging_snapshot.hpp>
 #include <nlohmann/json.hpp>
 #include <sdbusplus/bus.hpp>
 
+#include <functional>
+
 namespace openpower::faultlog
 {
 using ::openpower::guard::GuardRecords;
@@ -26,22 +30,44 @@ class UnresolvedPELs
   public:
     /** @brief Get count of unresolved pels with deconfig bit set
      *  @param[in] bus - D-Bus to attach to
+     *  @param[in] logging - logging entries details
      *  @param[in] ignorePwrFanPel - flag to add power/fan pel
      *
      *  @return 0 if no records are found else count of records
      */
-    static int getCount(sdbusplus::bus::bus& bus, bool ignorePwrFanPel);
+    static int getCount(sdbusplus::bus::bus& bus,
+                        const LoggingSnapshot& logging, bool ignorePwrFanPel);
 
     /** @brief Populate unresolved PEL's serviceable events to NAG json
      *
      *  @param[in] bus - D-Bus to attach to
      *  @param[in] guardRecords - hardware isolated records to parse
+     *  @param[in] devTree - device tree targets details
+     *  @param[in] logging - logging entries details
      *  @param[in/out] jsonNag - Json file capturing serviceable events
      *
      *  @return void
      */
     static void populate(sdbusplus::bus::bus& bus,
                          const GuardRecords& guardRecords,
+                         const DevTreeSnapshot& devTree,
+                         const LoggingSnapshot& logging,
                          nlohmann::json& jsonNag);
+
+    /** @brief Populate the CEC_ERROR_LOG elements one by one
+     *
+     *  @param[in] bus - D-Bus to attach to
+     *  @param[in] guardRecords - hardware isolated records to parse
+     *  @param[in] devTree - device tree targets details
+     *  @param[in] logging - logging entries details
+     *  @param[in] addErrorLog - callback to add each CEC_ERROR_LOG element
+     *                           once it is populated
+     *
+     *  @return void
+     */
+    static void
+        populate(sdbusplus::bus::bus& bus, const GuardRecords& guardRecords,
+                 const DevTreeSnapshot& devTree, const LoggingSnapshot& logging,
+                 const std::function<void(nlohmann::json&&)>& addErrorLog);
 };
 } // namespace openpower::faultlog
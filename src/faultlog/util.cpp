@@ -4,8 +4,9 @@
 #include <sdbusplus/exception.hpp>
 #include <util.hpp>
 
-#include <regex>
-#include <sstream>
+#include <array>
+#include <string_view>
+#include <utility>
 namespace openpower::faultlog
 {
 
@@ -14,9 +15,23 @@ using ProgressStages = sdbusplus::xyz::openbmc_project::State::Boot::server::
 using HostState =
     sdbusplus::xyz::openbmc_project::State::server::Host::HostState;
 
-std::string getGuardReason(const GuardRecords& guardRecords,
-                           const std::string& path)
+/**
+ * @brief get the guard reason string of the guard record error type
+ * @param[in] errType - error type of the guard record
+ *
+ * @return guard reason in upper case
+ */
+static std::string guardReasonToUpperStr(uint8_t errType)
 {
+    std::string reason = openpower::guard::guardReasonToStr(errType);
+    std::transform(reason.begin(), reason.end(), reason.begin(), ::toupper);
+    return reason;
+}
+
+std::unordered_map<std::string, std::string>
+    getGuardReasons(const GuardRecords& guardRecords)
+{
+    std::unordered_map<std::string, std::string> guardReasons;
     for (const auto& elem : guardRecords)
     {
         auto physicalPath = openpower::guard::getPhysicalPath(elem.targetId);
@@ -26,17 +41,10 @@ std::string getGuardReason(const GuardRecords& guardRecords,
                        "RECORD_ID", elem.recordId);
             continue;
         }
-        std::string phyPath(*physicalPath);
-        if (phyPath.find(path) != std::string::npos)
-        {
-            std::string reason =
-                openpower::guard::guardReasonToStr(elem.errType);
-            std::transform(reason.begin(), reason.end(), reason.begin(),
-                           ::toupper);
-            return reason;
-        }
+        guardReasons.emplace(*physicalPath,
+                             guardReasonToUpperStr(elem.errType));
     }
-    return "UNKNOWN";
+    return guardReasons;
 }
 ProgressStages getBootProgress(sdbusplus::bus::bus& bus)
 {
@@ -94,59 +102,122 @@ bool isHostStateRunning(sdbusplus::bus::bus& bus)
     return getHostState(bus) == HostState::Running;
 }
 
+/**
+ * @brief Callout keys in the matching order and the faultlog key name
+ */
+static constexpr std::array<std::pair<std::string_view, std::string_view>, 5>
+    calloutKeys{{{"Location Code", "Location Code"},
+                 {"Priority", "Priority"},
+                 {"PN", "Part Number"},
+                 {"SN", "Serial Number"},
+                 {"CCIN", "CCIN"}}};
+
+/**
+ * @brief Check whether the given char is a white space in callout
+ * @param[in] c - char to check
+ *
+ * @return true if white space else false
+ */
+static bool isCalloutSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' ||
+           c == '\r';
+}
+
+/**
+ * @brief Check whether the given char is allowed in callout value
+ * @param[in] c - char to check
+ *
+ * @return true if allowed in callout value else false
+ */
+static bool isCalloutValueChar(char c)
+{
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+           (c >= '0' && c <= '9') || c == '.' || c == '-';
+}
+
+/**
+ * @brief Add the key-value pairs found in the callout line to the object
+ * @param[in] line - callout line to parse
+ * @param[inout] jsonObject - JSON object to hold key-value pairs
+ */
+static void parseCalloutLine(std::string_view line, json& jsonObject)
+{
+    std::size_t pos = 0;
+    while (pos < line.size())
+    {
+        bool matched = false;
+        for (const auto& [key, name] : calloutKeys)
+        {
+            if (line.substr(pos, key.size()) != key)
+            {
+                continue;
+            }
+            std::size_t valueStart = pos + key.size();
+            if (valueStart >= line.size() || line[valueStart] != ':')
+            {
+                continue;
+            }
+            valueStart += 1;
+            while (valueStart < line.size() && isCalloutSpace(line[valueStart]))
+            {
+                valueStart += 1;
+            }
+            std::size_t valueEnd = valueStart;
+            while (valueEnd < line.size() && isCalloutValueChar(line[valueEnd]))
+            {
+                valueEnd += 1;
+            }
+            if (valueEnd == valueStart)
+            {
+                continue;
+            }
+            jsonObject[std::string(name)] =
+                std::string(line.substr(valueStart, valueEnd - valueStart));
+            // continue with the next key-value pair after this value
+            pos = valueEnd;
+            matched = true;
+            break;
+        }
+        if (!matched)
+        {
+            pos += 1;
+        }
+    }
+}
+
 json parseCallout(const std::string callout)
 {
     if (callout.empty())
     {
         return json::object();
     }
-    std::istringstream stream(callout);
-    std::string line;
 
-    // Regular expression to capture key-value pairs (ignores the starting
-    // number)
-    // Example 
+    // Parse key-value pairs from each line (ignores the starting number)
+    // Example
     // 1. LocationCode:xxxx, CCIN:XXX, SN:xxxx, PN:xxxx, Priority:xxx
     // 2. PN:xxxx, Priority:xxx
-    std::regex pattern(
-        R"((Location Code|Priority|PN|SN|CCIN):\s*([A-Za-z0-9.-]+))");
-
+    std::string_view remaining(callout);
     int lineCount = 0;
     json calloutsJson = json::array();
-    // Read each line and parse it directly into a JSON object
-    while (std::getline(stream, line))
+    while (!remaining.empty())
     {
-        if (!line.empty())
-        { // Ignore empty lines
-            lineCount += 1;
-            json jsonObject; // JSON object to hold key-value pairs
-            std::smatch matches;
-            std::string::const_iterator searchStart(line.cbegin());
-
-            // Use regex to find all key-value pairs in the current line
-            while (
-                std::regex_search(searchStart, line.cend(), matches, pattern))
-            {
-                std::string key = matches[1].str();
-                if (key == "SN")
-                {
-                    key = "Serial Number";
-                }
-                else if (key == "PN")
-                {
-                    key = "Part Number";
-                }
-                jsonObject[key] =
-                    matches[2].str(); // Assign key-value pairs to JSON object
-                searchStart = matches.suffix().first; // Move to the next match
-            }
-            calloutsJson.push_back(
-                jsonObject); // Add the JSON object to the array
+        auto lineEnd = remaining.find('\n');
+        std::string_view line = remaining.substr(0, lineEnd);
+        remaining.remove_prefix(
+            lineEnd == std::string_view::npos ? remaining.size() : lineEnd + 1);
+        if (line.empty())
+        {
+            continue; // Ignore empty lines
         }
+        lineCount += 1;
+        json jsonObject; // JSON object to hold key-value pairs
+        parseCalloutLine(line, jsonObject);
+        calloutsJson.push_back(std::move(jsonObject));
     }
     json sectionJson = json::object();
     sectionJson["Callout Count"] = lineCount;
-    sectionJson["Callouts"] = calloutsJson;
+    sectionJson["Callouts"] = std::move(calloutsJson);
     return sectionJson;
 }
 
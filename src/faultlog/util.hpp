@@ -7,6 +7,8 @@
 #include <xyz/openbmc_project/State/Boot/Progress/server.hpp>
 #include <xyz/openbmc_project/State/Host/server.hpp>
 
+#include <unordered_map>
+
 extern "C"
 {
 #include <libpdbg.h>
@@ -52,15 +54,16 @@ T readProperty(sdbusplus::bus::bus& bus, const std::string& service,
 }
 
 /**
- * @brief get the guard reason for the specified physical path
- *        of the pdbg target
+ * @brief get the guard reason of all the guard records by the physical path
+ *        of the guarded pdbg target
  * @param[in] guardRecords - guard records
- * @param[in] path - physical path of the pdbg target
  *
- * @return guard reason stored as part of the guard record
+ * @return guard reason stored as part of the guard record by the physical
+ *         path, the first guard record is used if more than one record
+ *         has the same physical path
  */
-std::string getGuardReason(const GuardRecords& guardRecords,
-                           const std::string& path);
+std::unordered_map<std::string, std::string>
+    getGuardReasons(const GuardRecords& guardRecords);
 
 /**
  * @brief Return true if host completed IPL and reached runtime
@@ -2,6 +2,8 @@
 
 #include "config.h"
 
+#include "common/dbus_prefetch.hpp"
+#include "common/phal_devtree_utils.hpp"
 #include "common/utils.hpp"
 #include "hw_isolation_event/hw_status_manager.hpp"
 #include "hw_isolation_record/manager.hpp"
@@ -10,19 +12,31 @@
 #include <sdeventplus/event.hpp>
 
 #include <format>
+#include <future>
 
 int main()
 {
     auto eventLoopRet = 0;
     try
     {
-        hw_isolation::utils::initExternalModules();
+        // Parse the device tree in the separate thread while the D-Bus
+        // data which are required to restore are prefetched since both
+        // are independent and taking the most of the startup time.
+        auto initModules = std::async(std::launch::async, []() {
+            hw_isolation::utils::initExternalModules();
+            hw_isolation::devtree::buildPhysPathIndex();
+        });
 
         auto bus = sdbusplus::bus::new_default();
 
         auto event = sdeventplus::Event::get_default();
         bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
 
+        hw_isolation::prefetch::prefetchRestoreData(bus);
+
+        // Rethrow the exception (if any) from the external modules init
+        initModules.get();
+
         // Add sdbusplus ObjectManager for the 'root' path of the hardware
         // isolation manager.
         sdbusplus::server::manager::manager objManager(bus,
@@ -32,18 +46,36 @@ int main()
                                                  event);
 
         // Restore the isolated hardwares from their persisted location.
+        // Note: The remaining isolated hardwares will be restored from
+        //       the event loop if the progressive startup is enabled.
         record_mgr.restore();
 
         hw_isolation::event::hw_status::Manager hwStatusMgr(bus, event,
                                                             record_mgr);
 
         // Restore the hardware status event from their persisted location.
-        hwStatusMgr.restore();
+        {
+            hw_isolation::prefetch::RestoreScope restoreScope;
+            hwStatusMgr.restore();
+        }
+
+#ifndef PROGRESSIVE_STARTUP
+        // Release the prefetched D-Bus data since the restore is finished.
+        // Note: In the progressive startup, it will be released once all
+        //       the isolated hardwares are restored and it is used only
+        //       by the restore path until then.
+        hw_isolation::prefetch::release();
+#endif
 
         /**
          * The name should be claimed after the D-Bus service is fully
          * initialized to avoid sending the "InterfacesAdded" signal
          * since we are restoring the existing object.
+         *
+         * In the progressive startup, the name is claimed once the cheaply
+         * restorable objects are restored and the clients can use the
+         * "xyz.openbmc_project.State.ServiceReady" interface to know
+         * whether all the objects are restored.
          */
         bus.request_name(HW_ISOLATION_BUSNAME);
 
@@ -6,9 +6,8 @@
 #include <phosphor-logging/elog-errors.hpp>
 
 #include <ctime>
-#include <filesystem>
 #include <format>
-#include <fstream>
+#include <sstream>
 
 // Associate Event Class with version number
 constexpr uint32_t Cereal_EventClassVersion = 1;
@@ -18,20 +17,18 @@ namespace hw_isolation
 {
 namespace event
 {
-namespace fs = std::filesystem;
-
 using namespace phosphor::logging;
 
 Event::Event(sdbusplus::bus::bus& bus, const std::string& objPath,
-             const EventId eventId, const EventSeverity eventSeverity,
-             const EventMsg& eventMsg,
+             EventStore& eventStore, const EventId eventId,
+             const EventSeverity eventSeverity, const EventMsg& eventMsg,
              const type::AssociationDef& associationDef,
              const bool reqDeserialize) :
     type::ServerObject<EventInterface, AssociationDefInterface>(
         bus, objPath.c_str(),
         type::ServerObject<EventInterface,
                            AssociationDefInterface>::action::defer_emit),
-    _bus(bus), _eventId(eventId)
+    _bus(bus), _eventStore(eventStore), _eventId(eventId)
 {
     // Setting properties which are defined in EventInterface
     message(eventMsg);
@@ -62,40 +59,38 @@ Event::Event(sdbusplus::bus::bus& bus, const std::string& objPath,
 
 Event::~Event()
 {
-    fs::path path{std::format(HW_ISOLATION_EVENT_PERSIST_PATH, _eventId)};
-    if (fs::exists(path))
-    {
-        fs::remove(path);
-    }
+    _eventStore.remove(_eventId);
 }
 
 void Event::serialize()
 {
-    fs::path path{std::format(HW_ISOLATION_EVENT_PERSIST_PATH, _eventId)};
     try
     {
-        std::ofstream os(path.c_str(), std::ios::binary);
-        cereal::BinaryOutputArchive oarchive(os);
-        oarchive(*this);
+        std::ostringstream os(std::ios::binary);
+        {
+            cereal::BinaryOutputArchive oarchive(os);
+            oarchive(*this);
+        }
+        _eventStore.put(_eventId, os.str());
     }
     catch (const cereal::Exception& e)
     {
         log<level::ERR>(std::format("Exception: [{}] during serialize the "
-                                    "hardware isolation status event into {}",
-                                    e.what(), path.string())
+                                    "hardware isolation status event [{}]",
+                                    e.what(), _eventId)
                             .c_str());
-        fs::remove(path);
+        _eventStore.remove(_eventId);
     }
 }
 
 void Event::deserialize()
 {
-    fs::path path{std::format(HW_ISOLATION_EVENT_PERSIST_PATH, _eventId)};
     try
     {
-        if (fs::exists(path))
+        auto payload = _eventStore.get(_eventId);
+        if (payload.has_value())
         {
-            std::ifstream is(path.c_str(), std::ios::in | std::ios::binary);
+            std::istringstream is(*payload, std::ios::binary);
             cereal::BinaryInputArchive iarchive(is);
             iarchive(*this);
         }
@@ -103,11 +98,34 @@ void Event::deserialize()
     catch (const cereal::Exception& e)
     {
         log<level::ERR>(std::format("Exception: [{}] during deserialize the "
-                                    "hardware isolation status event from {}",
-                                    e.what(), path.string())
+                                    "hardware isolation status event [{}]",
+                                    e.what(), _eventId)
                             .c_str());
-        fs::remove(path);
+        _eventStore.remove(_eventId);
+    }
+}
+
+bool Event::update(const EventSeverity eventSeverity, const EventMsg& eventMsg,
+                   const type::AssociationDef& associationDef)
+{
+    if ((message() == eventMsg) && (severity() == eventSeverity) &&
+        (associations() == associationDef))
+    {
+        return false;
     }
+
+    // The property change signal will be sent only for the changed
+    // properties.
+    message(eventMsg);
+    severity(eventSeverity);
+    associations(associationDef);
+
+    // Set the time of the event state change
+    std::time_t timeStamp = std::time(nullptr);
+    timestamp(timeStamp);
+
+    serialize();
+    return true;
 }
 
 } // namespace event
@@ -0,0 +1,425 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hw_isolation_event/event_store.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <format>
+
+namespace hw_isolation
+{
+namespace event
+{
+
+using namespace phosphor::logging;
+namespace fs = std::filesystem;
+
+constexpr std::array<uint8_t, 4> storeMagic{'H', 'W', 'E', 'R'};
+constexpr uint32_t storeVersion = 1;
+
+/**
+ * The header is kept in the separate region to allow extending
+ * without changing the slots offset.
+ */
+constexpr std::size_t storeHeaderRegionSize = 64;
+
+/**
+ * The events are created only for the non functional hardwares
+ * (processor cores and memory) so, the slot count is defined to fit
+ * the maximum system configuration and the slot size is defined to fit
+ * the event message, severity, timestamp and associations.
+ */
+constexpr uint32_t storeSlotCount = 512;
+constexpr uint32_t storeSlotSize = 1024;
+
+EventStore::EventStore(const std::string& path,
+                       persist::GroupCommit& groupCommit) :
+    _path(path), _groupCommit(groupCommit)
+{
+    static_assert(sizeof(Header) <= storeHeaderRegionSize);
+    static_assert(sizeof(SlotHeader) < storeSlotSize);
+
+    std::error_code ec;
+    fs::create_directories(fs::path(_path).parent_path(), ec);
+
+    open();
+}
+
+EventStore::~EventStore()
+{
+    _groupCommit.syncNow(_path);
+
+    if (_mappedStore != nullptr)
+    {
+        munmap(_mappedStore, _mappedSize);
+    }
+}
+
+bool EventStore::open()
+{
+    int fd = ::open(_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        log<level::ERR>(std::format("Failed to open the event store [{}] "
+                                    "errorno [{}] and errormsg [{}]",
+                                    _path, errno, strerror(errno))
+                            .c_str());
+        return false;
+    }
+
+    std::size_t storeSize = storeHeaderRegionSize +
+                            (static_cast<std::size_t>(storeSlotCount) *
+                             storeSlotSize);
+
+    struct stat fileStat;
+    bool resized{false};
+    if ((fstat(fd, &fileStat) != 0) ||
+        (static_cast<std::size_t>(fileStat.st_size) != storeSize))
+    {
+        if (ftruncate(fd, storeSize) != 0)
+        {
+            log<level::ERR>(std::format("Failed to resize the event store [{}] "
+                                        "errorno [{}] and errormsg [{}]",
+                                        _path, errno, strerror(errno))
+                                .c_str());
+            close(fd);
+            return false;
+        }
+        resized = true;
+    }
+
+    void* mappedStore = mmap(nullptr, storeSize, PROT_READ | PROT_WRITE,
+                             MAP_SHARED, fd, 0);
+    close(fd);
+    if (mappedStore == MAP_FAILED)
+    {
+        log<level::ERR>(std::format("Failed to map the event store [{}] "
+                                    "errorno [{}] and errormsg [{}]",
+                                    _path, errno, strerror(errno))
+                            .c_str());
+        return false;
+    }
+    _mappedStore = static_cast<uint8_t*>(mappedStore);
+    _mappedSize = storeSize;
+
+    const auto& storeHeader = header();
+    if (resized || (storeHeader.magic != storeMagic) ||
+        (storeHeader.version != storeVersion) ||
+        (storeHeader.slotCount != storeSlotCount) ||
+        (storeHeader.slotSize != storeSlotSize))
+    {
+        if (!resized)
+        {
+            log<level::ERR>(std::format("The event store [{}] layout is "
+                                        "changed, dropping the persisted "
+                                        "events",
+                                        _path)
+                                .c_str());
+        }
+
+        // Clear the slots since those are not in the current layout.
+        std::memset(_mappedStore + storeHeaderRegionSize, 0,
+                    storeSize - storeHeaderRegionSize);
+        initHeader(1);
+        requestSync();
+        return true;
+    }
+
+    if (storeHeader.checksum != getHeaderChecksum())
+    {
+        // The header is rewritten only while initializing and clearing
+        // so, the generation is recovered from the slots instead of
+        // dropping the valid slots.
+        auto generation = getLatestSlotGeneration();
+        log<level::ERR>(std::format("The event store [{}] header checksum is "
+                                    "invalid, recovered the generation [{}] "
+                                    "from the slots",
+                                    _path, generation)
+                            .c_str());
+        initHeader(generation);
+        requestSync();
+    }
+
+    load();
+    return true;
+}
+
+uint64_t EventStore::getLatestSlotGeneration() const
+{
+    uint64_t generation{1};
+    for (uint32_t slot = 0; slot < storeSlotCount; slot++)
+    {
+        const auto& slotHdr = slotHeader(slot);
+        if ((slotHdr.eventId != 0) &&
+            (slotHdr.payloadSize <= (storeSlotSize - sizeof(SlotHeader))) &&
+            (slotHdr.checksum == getSlotChecksum(slot)))
+        {
+            generation = std::max(generation, slotHdr.generation);
+        }
+    }
+    return generation;
+}
+
+void EventStore::load()
+{
+    bool staleSlotsFreed{false};
+    for (uint32_t slot = 0; slot < storeSlotCount; slot++)
+    {
+        if (!isValidSlot(slot))
+        {
+            continue;
+        }
+
+        // The event might be in two slots if the power is lost before
+        // freeing the replaced slot so, the latest sequence wins.
+        auto& slotHdr = slotHeader(slot);
+        auto [it, inserted] = _eventSlots.try_emplace(slotHdr.eventId, slot);
+        if (!inserted)
+        {
+            auto& persistedSlotHdr = slotHeader(it->second);
+            if (persistedSlotHdr.sequence < slotHdr.sequence)
+            {
+                persistedSlotHdr.eventId = 0;
+                it->second = slot;
+            }
+            else
+            {
+                slotHdr.eventId = 0;
+            }
+            staleSlotsFreed = true;
+        }
+    }
+
+    // Continue the sequence and the ring head from the latest slot.
+    for (const auto& [eventId, slot] : _eventSlots)
+    {
+        if (slotHeader(slot).sequence >= _sequence)
+        {
+            _sequence = slotHeader(slot).sequence;
+            _head = (slot + 1) % storeSlotCount;
+        }
+    }
+
+    if (staleSlotsFreed)
+    {
+        requestSync();
+    }
+}
+
+void EventStore::requestSync()
+{
+    _groupCommit.requestSync(_path, [this]() {
+        if (_mappedStore == nullptr)
+        {
+            return true;
+        }
+
+        if (msync(_mappedStore, _mappedSize, MS_SYNC) != 0)
+        {
+            return false;
+        }
+
+        // The replaced slots are freed only after the new slots are
+        // durable. Those are synced in the next batch but, it is fine
+        // to lose since the latest sequence wins while loading.
+        for (const auto slot : _replacedSlots)
+        {
+            slotHeader(slot).eventId = 0;
+        }
+        _replacedSlots.clear();
+        return true;
+    });
+}
+
+void EventStore::initHeader(const uint64_t generation)
+{
+    auto& storeHeader = header();
+    storeHeader.magic = storeMagic;
+    storeHeader.version = storeVersion;
+    storeHeader.slotCount = storeSlotCount;
+    storeHeader.slotSize = storeSlotSize;
+    storeHeader.generation = generation;
+    storeHeader.checksum = getHeaderChecksum();
+}
+
+EventStore::Header& EventStore::header() const
+{
+    return *reinterpret_cast<Header*>(_mappedStore);
+}
+
+EventStore::SlotHeader& EventStore::slotHeader(const uint32_t slot) const
+{
+    return *reinterpret_cast<SlotHeader*>(
+        _mappedStore + storeHeaderRegionSize +
+        (static_cast<std::size_t>(slot) * storeSlotSize));
+}
+
+uint8_t* EventStore::slotPayload(const uint32_t slot) const
+{
+    return reinterpret_cast<uint8_t*>(&slotHeader(slot)) + sizeof(SlotHeader);
+}
+
+uint32_t EventStore::getHeaderChecksum() const
+{
+    return persist::crc32(_mappedStore, offsetof(Header, checksum));
+}
+
+uint32_t EventStore::getSlotChecksum(const uint32_t slot) const
+{
+    const auto& slotHdr = slotHeader(slot);
+    auto crc = persist::crc32(reinterpret_cast<const uint8_t*>(&slotHdr),
+                              offsetof(SlotHeader, checksum));
+    return persist::crc32(slotPayload(slot), slotHdr.payloadSize, crc);
+}
+
+bool EventStore::isValidSlot(const uint32_t slot) const
+{
+    const auto& slotHdr = slotHeader(slot);
+    return (slotHdr.generation == header().generation) &&
+           (slotHdr.eventId != 0) &&
+           (slotHdr.payloadSize <= (storeSlotSize - sizeof(SlotHeader))) &&
+           (slotHdr.checksum == getSlotChecksum(slot));
+}
+
+std::vector<EventId> EventStore::getEventIds() const
+{
+    std::vector<EventId> eventIds;
+    eventIds.reserve(_eventSlots.size());
+    for (const auto& eventSlot : _eventSlots)
+    {
+        eventIds.push_back(eventSlot.first);
+    }
+    return eventIds;
+}
+
+std::optional<EventPayload> EventStore::get(const EventId eventId) const
+{
+    auto it = _eventSlots.find(eventId);
+    if (it == _eventSlots.end())
+    {
+        return std::nullopt;
+    }
+
+    return EventPayload(reinterpret_cast<const char*>(slotPayload(it->second)),
+                        slotHeader(it->second).payloadSize);
+}
+
+bool EventStore::put(const EventId eventId, const EventPayload& payload)
+{
+    if (_mappedStore == nullptr)
+    {
+        return false;
+    }
+
+    if (payload.size() > (storeSlotSize - sizeof(SlotHeader)))
+    {
+        log<level::ERR>(std::format("The event [{}] size [{}] is exceeded "
+                                    "the event store slot size [{}]",
+                                    eventId, payload.size(),
+                                    storeSlotSize - sizeof(SlotHeader))
+                            .c_str());
+        return false;
+    }
+
+    const auto& storeHeader = header();
+
+    // Always write into the next free slot from the ring head (even if
+    // the event is already persisted) so that the persisted event is not
+    // lost if the power is lost while writing.
+    std::optional<uint32_t> eventSlot;
+    for (uint32_t i = 0; i < storeSlotCount; i++)
+    {
+        auto slot = (_head + i) % storeSlotCount;
+        if (slotHeader(slot).generation != storeHeader.generation ||
+            slotHeader(slot).eventId == 0)
+        {
+            eventSlot = slot;
+            break;
+        }
+    }
+
+    if (!eventSlot.has_value())
+    {
+        log<level::ERR>(std::format("The event store is full, "
+                                    "failed to persist the event [{}]",
+                                    eventId)
+                            .c_str());
+        return false;
+    }
+
+    auto& slotHdr = slotHeader(*eventSlot);
+    slotHdr.generation = storeHeader.generation;
+    slotHdr.eventId = eventId;
+    slotHdr.sequence = ++_sequence;
+    slotHdr.payloadSize = payload.size();
+    slotHdr.reserved = 0;
+    std::memcpy(slotPayload(*eventSlot), payload.data(), payload.size());
+    slotHdr.checksum = getSlotChecksum(*eventSlot);
+
+    // The replaced slot is freed once the new slot is synced.
+    if (auto it = _eventSlots.find(eventId); it != _eventSlots.end())
+    {
+        _replacedSlots.push_back(it->second);
+        it->second = *eventSlot;
+    }
+    else
+    {
+        _eventSlots.emplace(eventId, *eventSlot);
+    }
+    _head = (*eventSlot + 1) % storeSlotCount;
+
+    requestSync();
+    return true;
+}
+
+void EventStore::remove(const EventId eventId)
+{
+    auto it = _eventSlots.find(eventId);
+    if (it == _eventSlots.end())
+    {
+        return;
+    }
+
+    // Mark the slot as free along with the replaced slots of the event
+    // to avoid loading the replaced payload.
+    std::erase_if(_replacedSlots, [this, eventId](const auto slot) {
+        if (slotHeader(slot).eventId != eventId)
+        {
+            return false;
+        }
+        slotHeader(slot).eventId = 0;
+        return true;
+    });
+    slotHeader(it->second).eventId = 0;
+    _eventSlots.erase(it);
+
+    requestSync();
+}
+
+void EventStore::clear()
+{
+    if (_mappedStore == nullptr)
+    {
+        return;
+    }
+
+    // The slots which are written in the old generation
+    // won't be considered as valid.
+    initHeader(header().generation + 1);
+    _eventSlots.clear();
+    _replacedSlots.clear();
+    _head = 0;
+
+    requestSync();
+}
+
+} // namespace event
+} // namespace hw_isolation
@@ -18,6 +18,9 @@ extern "C"
 
 #include <filesystem>
 #include <format>
+#include <fstream>
+#include <iterator>
+#include <set>
 
 namespace hw_isolation
 {
@@ -55,13 +58,19 @@ std::vector<event::EventMsg> deconfigTypes = {
 
 Manager::Manager(sdbusplus::bus::bus& bus, const sdeventplus::Event& eventLoop,
                  record::Manager& hwIsolationRecordMgr) :
-    _bus(bus), _eventLoop(eventLoop), _lastEventId(0), _isolatableHWs(bus),
+    _bus(bus), _eventLoop(eventLoop), _lastEventId(0),
+    _eventStore(HW_ISOLATION_EVENT_STORE_PATH,
+                hwIsolationRecordMgr.getGroupCommit()),
+    _isolatableHWs(bus),
     _hwIsolationRecordMgr(hwIsolationRecordMgr),
-    _requiredHwsPdbgClass({"ocmb", "fc"})
+    _requiredHwsPdbgClass({"ocmb", "fc"}),
+    _deallocatedHwsTimer(
+        eventLoop,
+        std::bind(
+            std::mem_fn(
+                &hw_isolation::event::hw_status::Manager::handleDeallocatedHws),
+            this))
 {
-    fs::create_directories(
-        fs::path(HW_ISOLATION_EVENT_PERSIST_PATH).parent_path());
-
     // Adding the required D-Bus match rules to create hardware status event
     // if interested signal is occurred.
     try
@@ -108,30 +117,11 @@ std::optional<sdbusplus::message::object_path> Manager::createEvent(
         auto eventObjPath = fs::path(HW_STATUS_EVENTS_PATH) /
                             std::to_string(id);
 
-        // Add association for the hareware inventory path which needs
-        // the hardware status event.
-        // Note: Association forward and reverse type are defined as per
-        // xyz::openbmc_project::Logging::Event interface associations
-        // documentation.
-        type::AsscDefFwdType eventIndicatorFwdType{"event_indicator"};
-        type::AsscDefRevType eventIndicatorRevType{"event_log"};
-        type::AssociationDef associationDeftoEvent;
-        associationDeftoEvent.push_back(std::make_tuple(
-            eventIndicatorFwdType, eventIndicatorRevType, hwInventoryPath));
-
-        // Add the error_log if given
-        if (!bmcErrorLogPath.empty())
-        {
-            type::AsscDefFwdType errorLogFwdType{"error_log"};
-            type::AsscDefFwdType errorLogRevType{"event_log"};
-            associationDeftoEvent.push_back(std::make_tuple(
-                errorLogFwdType, errorLogRevType, bmcErrorLogPath));
-        }
-
-        _hwStatusEvents.insert(
-            std::make_pair(id, std::make_unique<hw_isolation::event::Event>(
-                                   _bus, eventObjPath, id, eventSeverity,
-                                   eventMsg, associationDeftoEvent)));
+        addHwStatusEvent(
+            id, std::make_unique<hw_isolation::event::Event>(
+                    _bus, eventObjPath, _eventStore, id, eventSeverity,
+                    eventMsg,
+                    getEventAssociations(hwInventoryPath, bmcErrorLogPath)));
 
         // Update the last event id using the created event id;
         _lastEventId = id;
@@ -148,12 +138,129 @@ std::optional<sdbusplus::message::object_path> Manager::createEvent(
     return std::nullopt;
 }
 
-void Manager::clearHardwaresStatusEvent()
+void Manager::addHwStatusEvent(const EventId eventId,
+                               std::unique_ptr<Event> event)
+{
+    _hwStatusEventIds[getEventHwInventoryPath(*event)].emplace(eventId);
+    _hwStatusEvents.insert_or_assign(eventId, std::move(event));
+}
+
+HwStatusEvents::iterator
+    Manager::removeHwStatusEvent(HwStatusEvents::iterator eventIt)
+{
+    auto hwEventIds = _hwStatusEventIds.find(
+        getEventHwInventoryPath(*eventIt->second));
+    if (hwEventIds != _hwStatusEventIds.end())
+    {
+        hwEventIds->second.erase(eventIt->first);
+        if (hwEventIds->second.empty())
+        {
+            _hwStatusEventIds.erase(hwEventIds);
+        }
+    }
+    return _hwStatusEvents.erase(eventIt);
+}
+
+std::string Manager::getEventHwInventoryPath(const Event& event)
+{
+    for (const auto& assocEle : event.associations())
+    {
+        if (std::get<0>(assocEle) == "event_indicator")
+        {
+            return std::get<2>(assocEle);
+        }
+    }
+    return std::string();
+}
+
+type::AssociationDef
+    Manager::getEventAssociations(const std::string& hwInventoryPath,
+                                  const std::string& bmcErrorLogPath)
 {
-    // Remove all the existing hardware status event and
-    // reset the last event id as "0"
-    _hwStatusEvents.clear();
-    _lastEventId = 0;
+    // Add association for the hareware inventory path which needs
+    // the hardware status event.
+    // Note: Association forward and reverse type are defined as per
+    // xyz::openbmc_project::Logging::Event interface associations
+    // documentation.
+    type::AsscDefFwdType eventIndicatorFwdType{"event_indicator"};
+    type::AsscDefRevType eventIndicatorRevType{"event_log"};
+    type::AssociationDef associationDeftoEvent;
+    associationDeftoEvent.push_back(std::make_tuple(
+        eventIndicatorFwdType, eventIndicatorRevType, hwInventoryPath));
+
+    // Add the error_log if given
+    if (!bmcErrorLogPath.empty())
+    {
+        type::AsscDefFwdType errorLogFwdType{"error_log"};
+        type::AsscDefFwdType errorLogRevType{"event_log"};
+        associationDeftoEvent.push_back(std::make_tuple(
+            errorLogFwdType, errorLogRevType, bmcErrorLogPath));
+    }
+    return associationDeftoEvent;
+}
+
+void Manager::reconcileHardwaresStatusEvent(
+    const RequiredEvents& requiredEvents)
+{
+    std::size_t removedEvents{0}, updatedEvents{0}, createdEvents{0};
+
+    // Keep the existing event if it is still required for the hardware
+    // and remove others (including duplicate events for the same hardware).
+    std::set<std::string> existingEventHws;
+    for (auto it = _hwStatusEvents.begin(); it != _hwStatusEvents.end();)
+    {
+        auto hwInventoryPath = getEventHwInventoryPath(*it->second);
+
+        auto requiredEvent = requiredEvents.find(hwInventoryPath);
+        if ((requiredEvent == requiredEvents.end()) ||
+            !existingEventHws.emplace(hwInventoryPath).second)
+        {
+            it = removeHwStatusEvent(it);
+            removedEvents++;
+            continue;
+        }
+
+        if (it->second->update(
+                requiredEvent->second.severity, requiredEvent->second.msg,
+                getEventAssociations(hwInventoryPath,
+                                     requiredEvent->second.bmcErrorLogPath)))
+        {
+            updatedEvents++;
+        }
+        ++it;
+    }
+
+    for (const auto& [hwInventoryPath, requiredEvent] : requiredEvents)
+    {
+        if (existingEventHws.contains(hwInventoryPath))
+        {
+            continue;
+        }
+
+        auto eventObjPath =
+            createEvent(requiredEvent.severity, requiredEvent.msg,
+                        hwInventoryPath, requiredEvent.bmcErrorLogPath);
+        if (!eventObjPath.has_value())
+        {
+            log<level::ERR>(
+                std::format("Skipping to create the hardware "
+                            "status event because unable to create "
+                            "the event object for the given hardware "
+                            "[{}]",
+                            hwInventoryPath)
+                    .c_str());
+            error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
+                                      error_log::Level::Informational,
+                                      error_log::CollectTraces);
+            continue;
+        }
+        createdEvents++;
+    }
+
+    log<level::INFO>(std::format("Hardware status events are reconciled, "
+                                 "removed [{}], updated [{}] and created [{}]",
+                                 removedEvents, updatedEvents, createdEvents)
+                         .c_str());
 }
 
 std::pair<event::EventMsg, event::EventSeverity>
@@ -223,15 +330,36 @@ bool Manager::populateDetailsToCreateEvent(
                 return false;
             }
 
-            devtree::DevTreePhysPath devTreePhysPath;
-            std::copy(std::begin(physBinPath), std::end(physBinPath),
-                      std::back_inserter(devTreePhysPath));
+            devtree::EntityPathKey devTreePhysPath(physBinPath,
+                                                   sizeof(physBinPath));
+
+            if (_isolatableHWs.isKnownUnresolved(devTreePhysPath))
+            {
+                // The error is already logged when it is failed at first.
+                log<level::DEBUG>(
+                    std::format("Skipping to create the hardware status "
+                                "event because the inventory path is "
+                                "already failed to find for the given "
+                                "hardware [{}]",
+                                pdbg_target_path(tgt))
+                        .c_str());
+                return false;
+            }
 
-            // TODO: It is a workaround until fix the following
-            //       issue ibm-openbmc/dev/issues/3573.
-            bool ecoCore{false};
-            hwInventoryPath = _isolatableHWs.getInventoryPath(devTreePhysPath,
-                                                              ecoCore);
+            if (auto resolvedPath =
+                    _resolvedInventoryPaths.find(devTreePhysPath);
+                resolvedPath != _resolvedInventoryPaths.end())
+            {
+                hwInventoryPath = resolvedPath->second;
+            }
+            else
+            {
+                // TODO: It is a workaround until fix the following
+                //       issue ibm-openbmc/dev/issues/3573.
+                bool ecoCore{false};
+                hwInventoryPath =
+                    _isolatableHWs.getInventoryPath(devTreePhysPath, ecoCore);
+            }
 
             if (!hwInventoryPath.has_value())
             {
@@ -245,6 +373,7 @@ bool Manager::populateDetailsToCreateEvent(
                 error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
                                           error_log::Level::Informational,
                                           error_log::CollectTraces);
+                _isolatableHWs.setUnresolved(devTreePhysPath);
                 return false;
             }
             auto isolatedhwRecordInfo =
@@ -380,158 +509,164 @@ bool Manager::populateDetailsToCreateEvent(
     return false;
 }
 
-void Manager::restoreHardwaresStatusEvent(bool osRunning)
+std::vector<StatusEventTarget> Manager::getStatusEventTargets()
 {
-    clearHardwaresStatusEvent();
-
-    std::for_each(_requiredHwsPdbgClass.begin(), _requiredHwsPdbgClass.end(),
-                  [this, osRunning](const auto& ele) {
+    std::vector<StatusEventTarget> targets;
+    for (const auto& pdbgClass : _requiredHwsPdbgClass)
+    {
         struct pdbg_target* tgt;
-        pdbg_for_each_class_target(ele.c_str(), tgt)
+        pdbg_for_each_class_target(pdbgClass.c_str(), tgt)
         {
-            try
+            if (pdbgClass == "ocmb")
             {
-                if (ele == "fc")
+                // Look for all the logical Dimms under it to process
+                // them together.
+                StatusEventTarget ocmbTarget{tgt, {}};
+                struct pdbg_target* mpTgt;
+                struct pdbg_target* dimmTgt;
+                pdbg_for_each_target("mem_port", tgt, mpTgt)
                 {
-                    struct pdbg_target* coreTgt;
-                    bool ecoCore{false};
-                    pdbg_for_each_target("core", tgt, coreTgt)
-                    {
-                        if (devtree::isECOcore(coreTgt))
-                        {
-                            ecoCore = true;
-                            break;
-                        }
-                    }
-                    if (ecoCore)
+                    pdbg_for_each_target("dimm", mpTgt, dimmTgt)
                     {
-                        // ECO core is not modelled in the inventory so,
-                        // event is not required to display the state of
-                        // the core.
-                        continue;
+                        ocmbTarget.hws.push_back(dimmTgt);
                     }
                 }
-                else if (ele == "ocmb")
+                targets.push_back(std::move(ocmbTarget));
+                continue;
+            }
+
+            if (pdbgClass == "fc")
+            {
+                struct pdbg_target* coreTgt;
+                bool ecoCore{false};
+                pdbg_for_each_target("core", tgt, coreTgt)
                 {
-                    // Look for all the logical Dimms under it and
-                    // process them together
-                    struct pdbg_target* dimmTgt;
-                    struct pdbg_target* mpTgt;
-
-                    std::vector<event::EventMsg> eventMsgList;
-                    std::vector<event::EventSeverity> eventSeverityList;
-                    std::vector<record::entry::EntryErrLogPath>
-                        eventErrLogPathList;
-                    // hwInventoryPath - should be the same for both that
-                    // children under that ocmb.
-                    std::optional<sdbusplus::message::object_path>
-                        hwInventoryPath;
-
-                    // dimm0=functional, dimm2=functional : functional (normal
-                    // dualport) dimm0=functional, dimm2=deconfigured : ILLEGAL,
-                    // deconfigured dimm0=functional, dimm2=nonpresent :
-                    // functional (normal singleport) dimm0=deconfigured ,
-                    // dimm2=functional : ILLEGAL, deconfigured
-                    pdbg_for_each_target("mem_port", tgt, mpTgt)
+                    if (devtree::isECOcore(coreTgt))
                     {
-                        pdbg_for_each_target("dimm", mpTgt, dimmTgt)
-                        {
-                            bool createEvent = false;
-                            event::EventMsg eventMsg;
-                            event::EventSeverity eventSeverity;
-                            record::entry::EntryErrLogPath eventErrLogPath;
-                            createEvent = populateDetailsToCreateEvent(
-                                dimmTgt, osRunning, eventMsg, eventSeverity,
-                                eventErrLogPath, hwInventoryPath);
-                            // If we need to create an event wait and capture
-                            // all the events for that physical dimm and then
-                            // prioritize
-                            if (createEvent)
-                            {
-                                eventMsgList.push_back(eventMsg);
-                                eventSeverityList.push_back(eventSeverity);
-                                eventErrLogPathList.push_back(eventErrLogPath);
-                            }
-                        }
+                        ecoCore = true;
+                        break;
                     }
+                }
+                if (ecoCore)
+                {
+                    // ECO core is not modelled in the inventory so,
+                    // event is not required to display the state of
+                    // the core.
+                    continue;
+                }
+            }
+            targets.push_back(StatusEventTarget{tgt, {tgt}});
+        }
+    }
+    return targets;
+}
 
-                    // We have as many number of deconfigurations as there are
-                    // DIMMs
-                    if (eventMsgList.size() > 0)
-                    {
-                        if (!hwInventoryPath.has_value())
-                        {
-                            // already logged error. Continue
-                            continue;
-                        }
-                        auto errSeverityStr =
-                            sdbusplus::xyz::openbmc_project::Logging::server::
-                                convertForMessage(eventSeverityList[0]);
+void Manager::resolveHardwaresInventoryPath(
+    const std::vector<StatusEventTarget>& targets)
+{
+    std::vector<devtree::EntityPathKey> physPaths;
+    for (const auto& statusEventTarget : targets)
+    {
+        for (const auto& hw : statusEventTarget.hws)
+        {
+            ATTR_HWAS_STATE_Type hwasState;
+            ATTR_PHYS_BIN_PATH_Type physBinPath;
+            if (DT_GET_PROP(ATTR_HWAS_STATE, hw, hwasState) ||
+                !hwasState.present ||
+                DT_GET_PROP(ATTR_PHYS_BIN_PATH, hw, physBinPath))
+            {
+                // Will be handled while creating the event.
+                continue;
+            }
+            physPaths.emplace_back(physBinPath, sizeof(physBinPath));
+        }
+    }
 
-                        // See which isolation record has higher priority and
-                        // use it.
-                        int index = getHigherPrecendenceEvent(eventMsgList);
+    auto inventoryPaths = _isolatableHWs.resolveMany(physPaths);
+    for (std::size_t index = 0; index < physPaths.size(); index++)
+    {
+        _resolvedInventoryPaths.insert_or_assign(physPaths[index],
+                                                 inventoryPaths[index]);
+    }
+}
 
-                        auto eventObjPath = createEvent(
-                            eventSeverityList[index], eventMsgList[index],
-                            hwInventoryPath->str, eventErrLogPathList[index]);
+void Manager::restoreHardwaresStatusEvent(bool osRunning)
+{
+    auto targets = getStatusEventTargets();
+    resolveHardwaresInventoryPath(targets);
 
-                        if (!eventObjPath.has_value())
-                        {
-                            log<level::ERR>(
-                                std::format(
-                                    "Skipping to create the hardware "
-                                    "status event because unable to create "
-                                    "the event object for the given hardware "
-                                    "[{}]",
-                                    hwInventoryPath->str)
-                                    .c_str());
-                            error_log::createErrorLog(
-                                error_log::HwIsolationGenericErrMsg,
-                                error_log::Level::Informational,
-                                error_log::CollectTraces);
-                        }
-                    }
-                    continue;
-                }
+    RequiredEvents requiredEvents;
+    for (const auto& statusEventTarget : targets)
+    {
+        try
+        {
+            std::vector<event::EventMsg> eventMsgList;
+            std::vector<event::EventSeverity> eventSeverityList;
+            std::vector<record::entry::EntryErrLogPath> eventErrLogPathList;
+            // hwInventoryPath - should be the same for all the hardwares
+            // of the target (for example, children under that ocmb).
+            std::optional<sdbusplus::message::object_path> hwInventoryPath;
+
+            // dimm0=functional, dimm2=functional : functional (normal
+            // dualport) dimm0=functional, dimm2=deconfigured : ILLEGAL,
+            // deconfigured dimm0=functional, dimm2=nonpresent :
+            // functional (normal singleport) dimm0=deconfigured ,
+            // dimm2=functional : ILLEGAL, deconfigured
+            for (const auto& hw : statusEventTarget.hws)
+            {
                 event::EventMsg eventMsg;
                 event::EventSeverity eventSeverity;
                 record::entry::EntryErrLogPath eventErrLogPath;
-                std::optional<sdbusplus::message::object_path> hwInventoryPath;
-                bool create = false;
-
-                create = populateDetailsToCreateEvent(
-                    tgt, osRunning, eventMsg, eventSeverity, eventErrLogPath,
-                    hwInventoryPath);
-
-                if (create)
+                // If we need to create an event wait and capture
+                // all the events for that target and then prioritize
+                if (populateDetailsToCreateEvent(hw, osRunning, eventMsg,
+                                                 eventSeverity, eventErrLogPath,
+                                                 hwInventoryPath))
                 {
-                    if (!hwInventoryPath.has_value())
-                    {
-                        // already logged error. Continue
-                        continue;
-                    }
-
-                    auto eventObjPath = createEvent(eventSeverity, eventMsg,
-                                                    hwInventoryPath->str,
-                                                    eventErrLogPath);
+                    eventMsgList.push_back(eventMsg);
+                    eventSeverityList.push_back(eventSeverity);
+                    eventErrLogPathList.push_back(eventErrLogPath);
                 }
             }
-            catch (const std::exception& e)
+
+            if (eventMsgList.empty())
             {
-                log<level::ERR>(
-                    std::format("Exception [{}], skipping to create "
-                                "the hardware status event for the given "
-                                "hardware [{}]",
-                                e.what(), pdbg_target_path(tgt))
-                        .c_str());
-                error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
-                                          error_log::Level::Informational,
-                                          error_log::CollectTraces);
                 continue;
             }
+
+            if (!hwInventoryPath.has_value())
+            {
+                // already logged error. Continue
+                continue;
+            }
+
+            // See which isolation record has higher priority and use it.
+            int index = getHigherPrecendenceEvent(eventMsgList);
+
+            requiredEvents.insert_or_assign(
+                hwInventoryPath->str,
+                RequiredEvent{eventSeverityList[index], eventMsgList[index],
+                              eventErrLogPathList[index]});
         }
-    });
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(std::format("Exception [{}], skipping to create "
+                                        "the hardware status event for the "
+                                        "given hardware [{}]",
+                                        e.what(),
+                                        pdbg_target_path(
+                                            statusEventTarget.target))
+                                .c_str());
+            error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
+                                      error_log::Level::Informational,
+                                      error_log::CollectTraces);
+            continue;
+        }
+    }
+
+    _resolvedInventoryPaths.clear();
+
+    reconcileHardwaresStatusEvent(requiredEvents);
 }
 
 int Manager::getHigherPrecendenceEvent(
@@ -566,66 +701,65 @@ int Manager::getHigherPrecendenceEvent(
 
 void Manager::clearHwStatusEventIfexists(const std::string& hwInventoryPath)
 {
-    std::erase_if(_hwStatusEvents, [this, hwInventoryPath](const auto& ele) {
-        for (const auto& assocEle : ele.second->associations())
-        {
-            if ((std::get<0>(assocEle) == "event_indicator") &&
-                (std::get<2>(assocEle) == hwInventoryPath))
-            {
-                return true;
-            }
-        }
+    auto hwEventIds = _hwStatusEventIds.find(hwInventoryPath);
+    if (hwEventIds == _hwStatusEventIds.end())
+    {
+        return;
+    }
 
-        return false;
-    });
+    for (const auto& eventId : hwEventIds->second)
+    {
+        _hwStatusEvents.erase(eventId);
+    }
+    _hwStatusEventIds.erase(hwEventIds);
 }
 
-void Manager::handleDeallocatedHw()
+void Manager::handleDeallocatedHws()
 {
-    auto deallocatedHw = std::move(_deallocatedHwHandler.front());
-    _deallocatedHwHandler.pop();
-    if (deallocatedHw.second->isEnabled())
-    {
-        deallocatedHw.second->setEnabled(false);
-    }
+    auto deallocatedHws = std::move(_deallocatedHws);
+    _deallocatedHws.clear();
 
-    auto isolatedhwRecordInfo = _hwIsolationRecordMgr.getIsolatedHwRecordInfo(
-        std::string(deallocatedHw.first));
+    auto isolatedHwsRecordInfo =
+        _hwIsolationRecordMgr.getIsolatedHwsRecordInfo(deallocatedHws);
 
-    if (!isolatedhwRecordInfo.has_value())
+    for (const auto& deallocatedHw : deallocatedHws)
     {
-        // No action, just deconfigured without
-        // hardware isolation record
-        return;
-    }
+        auto isolatedhwRecordInfo = isolatedHwsRecordInfo.find(deallocatedHw);
+        if (isolatedhwRecordInfo == isolatedHwsRecordInfo.end())
+        {
+            // No action, just deconfigured without
+            // hardware isolation record
+            continue;
+        }
 
-    log<level::INFO>(std::format("{} is deallocated at the host runtime",
-                                 deallocatedHw.first)
-                         .c_str());
+        log<level::INFO>(std::format("{} is deallocated at the host runtime",
+                                     deallocatedHw)
+                             .c_str());
 
-    record::entry::EntryErrLogPath eventErrLogPath =
-        std::get<1>(*isolatedhwRecordInfo);
+        record::entry::EntryErrLogPath eventErrLogPath =
+            std::get<1>(isolatedhwRecordInfo->second);
 
-    auto hwStatusInfo =
-        getIsolatedHwStatusInfo(std::get<0>(*isolatedhwRecordInfo));
+        auto hwStatusInfo =
+            getIsolatedHwStatusInfo(std::get<0>(isolatedhwRecordInfo->second));
 
-    event::EventMsg eventMsg = std::get<0>(hwStatusInfo);
-    event::EventSeverity eventSeverity = std::get<1>(hwStatusInfo);
+        event::EventMsg eventMsg = std::get<0>(hwStatusInfo);
+        event::EventSeverity eventSeverity = std::get<1>(hwStatusInfo);
 
-    clearHwStatusEventIfexists(deallocatedHw.first);
+        clearHwStatusEventIfexists(deallocatedHw);
 
-    auto eventObjPath = createEvent(eventSeverity, eventMsg,
-                                    deallocatedHw.first, eventErrLogPath);
-    if (!eventObjPath.has_value())
-    {
-        log<level::ERR>(std::format("Failed to create the event for {} "
-                                    "that was deallocated at the host "
-                                    "runtime",
-                                    deallocatedHw.first)
-                            .c_str());
-        error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
-                                  error_log::Level::Informational,
-                                  error_log::CollectTraces);
+        auto eventObjPath = createEvent(eventSeverity, eventMsg, deallocatedHw,
+                                        eventErrLogPath);
+        if (!eventObjPath.has_value())
+        {
+            log<level::ERR>(std::format("Failed to create the event for {} "
+                                        "that was deallocated at the host "
+                                        "runtime",
+                                        deallocatedHw)
+                                .c_str());
+            error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
+                                      error_log::Level::Informational,
+                                      error_log::CollectTraces);
+        }
     }
 }
 
@@ -646,16 +780,18 @@ void Manager::onOperationalStatusChange(sdbusplus::message::message& message)
                 {
                     if (!(*propVal))
                     {
-                        _deallocatedHwHandler.emplace(std::make_pair(
-                            message.get_path(),
-                            std::make_unique<sdeventplus::utility::Timer<
-                                sdeventplus::ClockId::Monotonic>>(
-                                _eventLoop,
-                                std::bind(std::mem_fn(
-                                              &hw_isolation::event::hw_status::
-                                                  Manager::handleDeallocatedHw),
-                                          this),
-                                std::chrono::seconds(5))));
+                        // Wait for the hardware isolation record of
+                        // the deallocated hardwares and handle all
+                        // the hardwares which are deallocated together.
+                        // The timer is not restarted for the following
+                        // signals so that the continuous signals cannot
+                        // postpone the pending hardwares.
+                        _deallocatedHws.emplace(message.get_path());
+                        if (!_deallocatedHwsTimer.isEnabled())
+                        {
+                            _deallocatedHwsTimer.restartOnce(
+                                std::chrono::seconds(5));
+                        }
                     }
                 }
                 else
@@ -900,31 +1036,63 @@ bool Manager::isOSRunning()
     return false;
 }
 
+void Manager::migratePersistedEventFiles()
+{
+    fs::path eventsDir{
+        fs::path(HW_ISOLATION_EVENT_PERSIST_PATH).parent_path()};
+
+    std::error_code ec;
+    if (!fs::exists(eventsDir, ec))
+    {
+        return;
+    }
+
+    // The event persisted file is having the same serialized data
+    // which is stored in the event store.
+    for (const auto& file : fs::directory_iterator(eventsDir, ec))
+    {
+        try
+        {
+            std::ifstream is(file.path(), std::ios::in | std::ios::binary);
+            EventPayload payload{std::istreambuf_iterator<char>(is),
+                                 std::istreambuf_iterator<char>()};
+
+            _eventStore.put(std::stoul(file.path().filename()), payload);
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(std::format("Exception [{}] while migrating the "
+                                        "event persisted file [{}]",
+                                        e.what(), file.path().string())
+                                .c_str());
+        }
+    }
+    fs::remove_all(eventsDir, ec);
+}
+
 void Manager::restorePersistedHwIsolationStatusEvent()
 {
-    auto createEventForPersistedEventFile = [this](const auto& file) {
-        auto fileEventId = std::stoul(file.path().filename());
+    migratePersistedEventFiles();
 
+    auto createEventForPersistedEvent = [this](const auto& eventId) {
         auto eventObjPath = fs::path(HW_STATUS_EVENTS_PATH) /
-                            file.path().filename();
+                            std::to_string(eventId);
 
-        // All members will be filled from persisted file.
-        this->_hwStatusEvents.insert(std::make_pair(
-            fileEventId,
-            std::make_unique<hw_isolation::event::Event>(
-                this->_bus, eventObjPath, fileEventId, event::EventSeverity(),
-                event::EventMsg(), type::AssociationDef(), true)));
+        // All members will be filled from the event store.
+        this->addHwStatusEvent(
+            eventId, std::make_unique<hw_isolation::event::Event>(
+                         this->_bus, eventObjPath, this->_eventStore, eventId,
+                         event::EventSeverity(), event::EventMsg(),
+                         type::AssociationDef(), true));
 
-        if (this->_lastEventId < fileEventId)
+        if (this->_lastEventId < eventId)
         {
-            this->_lastEventId = fileEventId;
+            this->_lastEventId = eventId;
         }
     };
 
-    std::ranges::for_each(
-        fs::directory_iterator(
-            fs::path(HW_ISOLATION_EVENT_PERSIST_PATH).parent_path()),
-        createEventForPersistedEventFile);
+    std::ranges::for_each(_eventStore.getEventIds(),
+                          createEventForPersistedEvent);
 }
 
 void Manager::restore()
@@ -27,6 +27,8 @@ namespace fs = std::filesystem;
 
 using namespace phosphor::logging;
 
+std::size_t Entry::skippedWritesCount = 0;
+
 Entry::Entry(sdbusplus::bus::bus& bus, const std::string& objPath,
              hw_isolation::record::Manager& hwIsolationRecordMgr,
              const EntryRecordId entryRecordId,
@@ -40,7 +42,8 @@ Entry::Entry(sdbusplus::bus::bus& bus, const std::string& objPath,
         type::ServerObject<EntryInterface, AssociationDefInterface, EpochTime,
                            DeleteInterface>::action::defer_emit),
     _bus(bus), _hwIsolationRecordMgr(hwIsolationRecordMgr),
-    _entryRecordId(entryRecordId), _entityPath(entityPath)
+    _entryRecordId(entryRecordId), _entityPath(entityPath),
+    _entityPathKey(entityPath)
 {
     // Setting properties which are defined in EntryInterface
     severity(isolatedHwSeverity);
@@ -68,11 +71,7 @@ Entry::Entry(sdbusplus::bus::bus& bus, const std::string& objPath,
 
 Entry::~Entry()
 {
-    fs::path path{std::format(HW_ISOLATION_ENTRY_PERSIST_PATH, _entryRecordId)};
-    if (fs::exists(path))
-    {
-        fs::remove(path);
-    }
+    _hwIsolationRecordMgr.getEntryJournal().remove(_entryRecordId);
 }
 
 void Entry::resolveEntry(bool clearRecord)
@@ -113,6 +112,11 @@ openpower_guard::EntityPath Entry::getEntityPath() const
     return _entityPath;
 }
 
+const devtree::EntityPathKey& Entry::getEntityPathKey() const
+{
+    return _entityPathKey;
+}
+
 EntryRecordId Entry::getEntryRecId() const
 {
     return _entryRecordId;
@@ -120,24 +124,41 @@ EntryRecordId Entry::getEntryRecId() const
 
 void Entry::serialize()
 {
-    fs::path path{std::format(HW_ISOLATION_ENTRY_PERSIST_PATH, _entryRecordId)};
-    try
+    if (!_dirty)
     {
-        std::ofstream os(path.c_str(), std::ios::binary);
-        cereal::BinaryOutputArchive oarchive(os);
-        oarchive(*this);
+        skippedWritesCount++;
+        return;
     }
-    catch (const cereal::Exception& e)
+
+    _hwIsolationRecordMgr.getEntryJournal().put(
+        _entryRecordId, EntryJournal::Record{_entityPathKey, elapsed()});
+    _dirty = false;
+}
+
+bool Entry::deserialize()
+{
+    auto record = _hwIsolationRecordMgr.getEntryJournal().get(_entryRecordId);
+    if (!record.has_value())
     {
-        log<level::ERR>(std::format("Exception: [{}] during serialize the "
-                                    "hardware isolation entry into {}",
-                                    e.what(), path.string())
-                            .c_str());
-        fs::remove(path);
+        return migratePersistedFile();
+    }
+
+    if (record->entityPath == _entityPathKey)
+    {
+        // Skip to send property change signal in the restore path.
+        elapsed(record->elapsed, true);
+
+        // The entry members are same as the persisted members.
+        _dirty = false;
     }
+    else
+    {
+        serialize();
+    }
+    return true;
 }
 
-bool Entry::deserialize()
+bool Entry::migratePersistedFile()
 {
     fs::path path{std::format(HW_ISOLATION_ENTRY_PERSIST_PATH, _entryRecordId)};
     try
@@ -147,6 +168,10 @@ bool Entry::deserialize()
             std::ifstream is(path.c_str(), std::ios::in | std::ios::binary);
             cereal::BinaryInputArchive iarchive(is);
             iarchive(*this);
+            is.close();
+
+            serialize();
+            fs::remove(path);
             return true;
         }
         return false;
@@ -162,6 +187,20 @@ bool Entry::deserialize()
     }
 }
 
+uint64_t Entry::elapsed(uint64_t value, bool skipSignal)
+{
+    if (value != EpochTime::elapsed())
+    {
+        _dirty = true;
+    }
+    return EpochTime::elapsed(value, skipSignal);
+}
+
+std::size_t Entry::getSkippedWritesCount()
+{
+    return skippedWritesCount;
+}
+
 namespace utils
 {
 
@@ -0,0 +1,352 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hw_isolation_record/entry_journal.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace record
+{
+namespace entry
+{
+
+using namespace phosphor::logging;
+namespace fs = std::filesystem;
+
+/**
+ * The journal file layout:
+ *  Header: magic (4 bytes) | version (4 bytes)
+ *  Record: operation (1 byte) | entry record id (4 bytes) |
+ *          entity path (21 bytes) | elapsed (8 bytes) | crc32 (4 bytes)
+ *
+ * @note The multi byte fields are stored in the host byte order since
+ *       the journal is not shared with other applications.
+ */
+constexpr std::array<uint8_t, 4> journalMagic{'H', 'W', 'I', 'J'};
+constexpr uint32_t journalVersion = 1;
+constexpr std::size_t journalHeaderSize = journalMagic.size() +
+                                          sizeof(journalVersion);
+constexpr std::size_t journalRecordSize =
+    sizeof(uint8_t) + sizeof(EntryRecordId) + devtree::EntityPathKey::maxSize +
+    sizeof(uint64_t) + sizeof(uint32_t);
+
+/**
+ * The journal won't be compacted until it has this many records
+ * to avoid compacting frequently if there are only few entries.
+ */
+constexpr std::size_t minRecordsToCompact = 128;
+
+using JournalHeader = std::array<uint8_t, journalHeaderSize>;
+using JournalRecord = std::array<uint8_t, journalRecordSize>;
+
+namespace
+{
+
+JournalHeader encodeHeader()
+{
+    JournalHeader header;
+    std::memcpy(header.data(), journalMagic.data(), journalMagic.size());
+    std::memcpy(header.data() + journalMagic.size(), &journalVersion,
+                sizeof(journalVersion));
+    return header;
+}
+
+JournalRecord encodeRecord(const uint8_t operation,
+                           const EntryRecordId entryRecordId,
+                           const EntryJournal::Record& record)
+{
+    JournalRecord rawRecord;
+    auto pos = rawRecord.data();
+
+    std::memcpy(pos, &operation, sizeof(operation));
+    pos += sizeof(operation);
+    std::memcpy(pos, &entryRecordId, sizeof(entryRecordId));
+    pos += sizeof(entryRecordId);
+    std::memcpy(pos, record.entityPath.data(), devtree::EntityPathKey::maxSize);
+    pos += devtree::EntityPathKey::maxSize;
+    std::memcpy(pos, &record.elapsed, sizeof(record.elapsed));
+    pos += sizeof(record.elapsed);
+
+    uint32_t checksum = persist::crc32(rawRecord.data(),
+                                       pos - rawRecord.data());
+    std::memcpy(pos, &checksum, sizeof(checksum));
+
+    return rawRecord;
+}
+
+} // namespace
+
+EntryJournal::EntryJournal(const std::string& path,
+                           persist::GroupCommit& groupCommit) :
+    _path(path), _groupCommit(groupCommit)
+{
+    std::error_code ec;
+    fs::create_directories(fs::path(_path).parent_path(), ec);
+
+    load();
+    open();
+}
+
+EntryJournal::~EntryJournal()
+{
+    _groupCommit.syncNow(_path);
+
+    if (_fd >= 0)
+    {
+        close(_fd);
+    }
+}
+
+void EntryJournal::load()
+{
+    std::ifstream is(_path, std::ios::in | std::ios::binary);
+    if (!is)
+    {
+        // Nothing is persisted yet
+        return;
+    }
+
+    std::vector<uint8_t> journal{std::istreambuf_iterator<char>(is),
+                                 std::istreambuf_iterator<char>()};
+    is.close();
+
+    if ((journal.size() < journalHeaderSize) ||
+        !std::equal(journal.begin(), journal.begin() + journalHeaderSize,
+                    encodeHeader().begin()))
+    {
+        log<level::ERR>(std::format("The journal [{}] header is invalid, "
+                                    "dropping the persisted entries",
+                                    _path)
+                            .c_str());
+        std::error_code ec;
+        fs::remove(_path, ec);
+        return;
+    }
+
+    std::size_t validSize{journalHeaderSize};
+    while ((validSize + journalRecordSize) <= journal.size())
+    {
+        auto pos = journal.data() + validSize;
+
+        uint32_t checksum;
+        std::memcpy(&checksum, pos + journalRecordSize - sizeof(checksum),
+                    sizeof(checksum));
+        if (checksum !=
+            persist::crc32(pos, journalRecordSize - sizeof(checksum)))
+        {
+            break;
+        }
+
+        uint8_t operation;
+        EntryRecordId entryRecordId;
+        uint64_t elapsed;
+
+        std::memcpy(&operation, pos, sizeof(operation));
+        pos += sizeof(operation);
+        std::memcpy(&entryRecordId, pos, sizeof(entryRecordId));
+        pos += sizeof(entryRecordId);
+        devtree::EntityPathKey entityPath(pos, devtree::EntityPathKey::maxSize);
+        pos += devtree::EntityPathKey::maxSize;
+        std::memcpy(&elapsed, pos, sizeof(elapsed));
+
+        if (operation == static_cast<uint8_t>(Operation::Put))
+        {
+            _records.insert_or_assign(entryRecordId,
+                                      Record{entityPath, elapsed});
+        }
+        else
+        {
+            _records.erase(entryRecordId);
+        }
+
+        validSize += journalRecordSize;
+        _journalRecordsCount++;
+    }
+
+    if (validSize != journal.size())
+    {
+        log<level::ERR>(
+            std::format("The journal [{}] is having the partial or corrupted "
+                        "records from offset [{}], dropping those records",
+                        _path, validSize)
+                .c_str());
+        std::error_code ec;
+        fs::resize_file(_path, validSize, ec);
+    }
+}
+
+bool EntryJournal::open()
+{
+    _fd = ::open(_path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (_fd < 0)
+    {
+        log<level::ERR>(std::format("Failed to open the journal [{}] "
+                                    "errorno [{}] and errormsg [{}]",
+                                    _path, errno, strerror(errno))
+                            .c_str());
+        return false;
+    }
+
+    if (lseek(_fd, 0, SEEK_END) == 0)
+    {
+        auto header = encodeHeader();
+        if (write(_fd, header.data(), header.size()) !=
+            static_cast<ssize_t>(header.size()))
+        {
+            log<level::ERR>(std::format("Failed to write the journal [{}] "
+                                        "header errorno [{}]",
+                                        _path, errno)
+                                .c_str());
+            close(_fd);
+            _fd = -1;
+            std::error_code ec;
+            fs::remove(_path, ec);
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<EntryJournal::Record>
+    EntryJournal::get(const EntryRecordId entryRecordId) const
+{
+    auto it = _records.find(entryRecordId);
+    if (it == _records.end())
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void EntryJournal::put(const EntryRecordId entryRecordId, const Record& record)
+{
+    _records.insert_or_assign(entryRecordId, record);
+    append(Operation::Put, entryRecordId, record);
+}
+
+void EntryJournal::remove(const EntryRecordId entryRecordId)
+{
+    auto it = _records.find(entryRecordId);
+    if (it == _records.end())
+    {
+        return;
+    }
+
+    // Keep the removed record data to identify in the journal file.
+    auto record = it->second;
+    _records.erase(it);
+    append(Operation::Remove, entryRecordId, record);
+}
+
+void EntryJournal::append(const Operation operation,
+                          const EntryRecordId entryRecordId,
+                          const Record& record)
+{
+    // The live records are already updated by the caller so, the journal
+    // file is rewritten with the live records (including this operation)
+    // if the previous append was failed.
+    if (_needsCompact)
+    {
+        compact();
+        return;
+    }
+
+    if ((_fd < 0) && !open())
+    {
+        _needsCompact = true;
+        return;
+    }
+
+    auto offset = lseek(_fd, 0, SEEK_END);
+    auto rawRecord = encodeRecord(static_cast<uint8_t>(operation),
+                                  entryRecordId, record);
+    if (write(_fd, rawRecord.data(), rawRecord.size()) !=
+        static_cast<ssize_t>(rawRecord.size()))
+    {
+        log<level::ERR>(std::format("Failed to append the entry [{}] into the "
+                                    "journal [{}] errorno [{}]",
+                                    entryRecordId, _path, errno)
+                            .c_str());
+
+        // Drop the partially written record, otherwise the records appended
+        // after this will be dropped while loading.
+        if ((offset < 0) || (ftruncate(_fd, offset) != 0))
+        {
+            log<level::ERR>(std::format("Failed to drop the partial record "
+                                        "from the journal [{}] errorno [{}]",
+                                        _path, errno)
+                                .c_str());
+        }
+
+        // This operation is not persisted so, rewrite the journal with
+        // the live records to keep the journal file same as the live records.
+        compact();
+        return;
+    }
+    _journalRecordsCount++;
+
+    // The compacted journal is already synced so, the closed journal
+    // is not required to sync.
+    _groupCommit.requestSync(
+        _path, [this]() { return (_fd < 0) || (fsync(_fd) == 0); });
+
+    if (_journalRecordsCount >
+        std::max(minRecordsToCompact, _records.size() * 2))
+    {
+        compact();
+    }
+}
+
+void EntryJournal::compact()
+{
+    std::string journal;
+    journal.reserve(journalHeaderSize + (_records.size() * journalRecordSize));
+
+    auto header = encodeHeader();
+    journal.append(reinterpret_cast<const char*>(header.data()), header.size());
+
+    for (const auto& [entryRecordId, record] : _records)
+    {
+        auto rawRecord = encodeRecord(static_cast<uint8_t>(Operation::Put),
+                                      entryRecordId, record);
+        journal.append(reinterpret_cast<const char*>(rawRecord.data()),
+                       rawRecord.size());
+    }
+
+    // The compacted journal is replaced immediately (instead of staging in
+    // the group commit) since the following records must be appended into
+    // the compacted journal.
+    if (!persist::writeFileAtomically(_path, journal))
+    {
+        log<level::ERR>(
+            std::format("Failed to compact the journal [{}]", _path).c_str());
+        _needsCompact = true;
+        return;
+    }
+    _needsCompact = false;
+
+    if (_fd >= 0)
+    {
+        close(_fd);
+        _fd = -1;
+    }
+    _journalRecordsCount = _records.size();
+    open();
+}
+
+} // namespace entry
+} // namespace record
+} // namespace hw_isolation
@@ -5,6 +5,7 @@
 #include "hw_isolation_record/manager.hpp"
 
 #include "common/common_types.hpp"
+#include "common/dbus_prefetch.hpp"
 #include "common/utils.hpp"
 #include "common/error_log.hpp"
 
@@ -12,10 +13,11 @@
 #include <phosphor-logging/elog-errors.hpp>
 #include <xyz/openbmc_project/State/Chassis/server.hpp>
 
+#include <atomic>
 #include <filesystem>
 #include <format>
 #include <fstream>
-#include <iomanip>
+#include <future>
 #include <ranges>
 #include <sstream>
 
@@ -34,11 +36,28 @@ namespace fs = std::filesystem;
 constexpr auto HW_ISOLATION_ENTRY_MGR_PERSIST_PATH =
     "/var/lib/op-hw-isolation/persistdata/record_mgr/{}";
 
+/**
+ * The maximum number of worker threads (each one is using the private bus
+ * connection) to resolve the records concurrently while restoring.
+ */
+constexpr std::size_t restoreWorkersCount = 4;
+
+#ifdef PROGRESSIVE_STARTUP
+/**
+ * The number of records to resolve in one event loop iteration
+ * while restoring progressively.
+ */
+constexpr std::size_t restoreChunkSize = 8;
+#endif
+
 Manager::Manager(sdbusplus::bus::bus& bus, const std::string& objPath,
                  const sdeventplus::Event& eventLoop) :
-    type::ServerObject<CreateInterface, DeleteAllInterface>(bus,
-                                                            objPath.c_str()),
-    _bus(bus), _eventLoop(eventLoop), _isolatableHWs(bus),
+    type::ServerObject<CreateInterface, DeleteAllInterface,
+                       ServiceReadyInterface>(bus, objPath.c_str()),
+    _bus(bus), _eventLoop(eventLoop),
+    _groupCommit(eventLoop, persist::HW_ISOLATION_PERSIST_PATH),
+    _entryJournal(HW_ISOLATION_ENTRY_JOURNAL_PATH, _groupCommit),
+    _isolatableHWs(bus),
     _guardFileWatch(
         eventLoop.get(), IN_NONBLOCK, IN_CLOSE_WRITE, EPOLLIN,
         openpower_guard::getGuardFilePath(),
@@ -46,12 +65,27 @@ Manager::Manager(sdbusplus::bus::bus& bus, const std::string& objPath,
                                   processHardwareIsolationRecordFile),
                   this))
 {
-    fs::create_directories(
-        fs::path(HW_ISOLATION_ENTRY_PERSIST_PATH).parent_path());
+    // Will be enabled once the restore is finished.
+    state(ServiceReadyInterface::States::Starting, true);
 
     deserialize();
 }
 
+Manager::~Manager()
+{
+    _groupCommit.commit();
+}
+
+entry::EntryJournal& Manager::getEntryJournal()
+{
+    return _entryJournal;
+}
+
+persist::GroupCommit& Manager::getGroupCommit()
+{
+    return _groupCommit;
+}
+
 void Manager::serialize()
 {
     fs::path path{
@@ -59,16 +93,19 @@ void Manager::serialize()
 
     if (_persistedEcoCores.empty())
     {
-        fs::remove(path);
+        _groupCommit.stageRemove(path);
         return;
     }
 
     fs::create_directories(path.parent_path());
     try
     {
-        std::ofstream os(path.c_str(), std::ios::binary);
-        cereal::BinaryOutputArchive oarchive(os);
-        oarchive(*this);
+        std::ostringstream os(std::ios::binary);
+        {
+            cereal::BinaryOutputArchive oarchive(os);
+            oarchive(*this);
+        }
+        _groupCommit.stageFile(path, os.str());
     }
     catch (const cereal::Exception& e)
     {
@@ -76,7 +113,6 @@ void Manager::serialize()
                                     "eco cores physical path into {}",
                                     e.what(), path.string())
                             .c_str());
-        fs::remove(path);
     }
 }
 
@@ -107,17 +143,34 @@ bool Manager::deserialize()
 }
 
 void Manager::updateEcoCoresList(
-    const bool ecoCore, const devtree::DevTreePhysPath& coreDevTreePhysPath)
+    const bool ecoCore, const devtree::EntityPathKey& coreDevTreePhysPath)
 {
+    bool updated{false};
     if (ecoCore)
     {
-        _persistedEcoCores.emplace(coreDevTreePhysPath);
+        updated = _persistedEcoCores.emplace(coreDevTreePhysPath).second;
     }
     else
     {
-        _persistedEcoCores.erase(coreDevTreePhysPath);
+        updated = _persistedEcoCores.erase(coreDevTreePhysPath) > 0;
+    }
+
+    // Just mark to write behind, will flush by the caller.
+    if (updated)
+    {
+        _ecoCoresDirty = true;
+    }
+}
+
+void Manager::flushEcoCores()
+{
+    if (_ecoCoresDirty)
+    {
+        // Many updates in the same event loop iteration will be
+        // persisted once.
+        _groupCommit.schedule("eco_cores", [this]() { serialize(); });
+        _ecoCoresDirty = false;
     }
-    serialize();
 }
 
 std::optional<uint32_t>
@@ -180,10 +233,14 @@ std::optional<sdbusplus::message::object_path> Manager::createEntry(
                 bmcErrorLogFwdType, bmcErrorLogRevType, bmcErrorLog));
         }
 
-        _isolatedHardwares.insert(std::make_pair(
+        auto [entryIt, inserted] = _isolatedHardwares.insert(std::make_pair(
             recordId, std::make_unique<entry::Entry>(
                           _bus, entryObjPath, *this, recordId, severity,
                           resolved, associationDeftoHw, entityPath)));
+        if (inserted)
+        {
+            _entryIndex.emplace(entryIt->second->getEntityPathKey(), recordId);
+        }
 
         utils::setEnabledProperty(_bus, isolatedHardware, resolved);
 
@@ -209,14 +266,12 @@ std::pair<bool, sdbusplus::message::object_path> Manager::updateEntry(
     const std::string& isolatedHwDbusObjPath, const std::string& bmcErrorLog,
     const openpower_guard::EntityPath& entityPath)
 {
-    auto isolatedHwIt =
-        std::find_if(_isolatedHardwares.begin(), _isolatedHardwares.end(),
-                     [recordId, entityPath](const auto& isolatedHw) {
-        return ((isolatedHw.second->getEntityPath() == entityPath) &&
-                (isolatedHw.second->getEntryRecId() == recordId));
-    });
-
-    if (isolatedHwIt == _isolatedHardwares.end())
+    // The record id is unique so, just make sure the found entry is
+    // for the same hardware.
+    auto isolatedHwIt = _isolatedHardwares.find(recordId);
+    if ((isolatedHwIt == _isolatedHardwares.end()) ||
+        (isolatedHwIt->second->getEntityPathKey() !=
+         devtree::EntityPathKey(entityPath)))
     {
         // D-Bus entry does not exist
         return std::make_pair(false, std::string());
@@ -417,13 +472,31 @@ sdbusplus::message::object_path Manager::createWithErrorLog(
 
 void Manager::eraseEntry(const entry::EntryRecordId entryRecordId)
 {
-    if (_isolatedHardwares.contains(entryRecordId))
+    auto entryIt = _isolatedHardwares.find(entryRecordId);
+    if (entryIt == _isolatedHardwares.end())
+    {
+        return;
+    }
+
+    const auto entityPathKey = entryIt->second->getEntityPathKey();
+    updateEcoCoresList(false, entityPathKey);
+    removeFromEntryIndex(entryRecordId, entityPathKey);
+    _isolatedHardwares.erase(entryIt);
+
+    flushEcoCores();
+}
+
+void Manager::removeFromEntryIndex(const entry::EntryRecordId entryRecordId,
+                                   const devtree::EntityPathKey& entityPathKey)
+{
+    auto [begin, end] = _entryIndex.equal_range(entityPathKey);
+    auto indexIt = std::find_if(begin, end, [entryRecordId](const auto& ele) {
+        return ele.second == entryRecordId;
+    });
+    if (indexIt != end)
     {
-        updateEcoCoresList(
-            false, devtree::convertEntityPathIntoRawData(
-                       _isolatedHardwares.at(entryRecordId)->getEntityPath()));
+        _entryIndex.erase(indexIt);
     }
-    _isolatedHardwares.erase(entryRecordId);
 }
 
 void Manager::clearDbusEntries()
@@ -494,13 +567,17 @@ bool Manager::isValidRecord(const entry::EntryRecordId recordId)
 void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
                                    const bool isRestorePath)
 {
-    auto entityPathRawData =
-        devtree::convertEntityPathIntoRawData(record.targetId);
-    std::stringstream ss;
-    std::for_each(entityPathRawData.begin(), entityPathRawData.end(),
-                  [&ss](const auto& ele) {
-        ss << std::setw(2) << std::setfill('0') << std::hex << (int)ele << " ";
-    });
+    const devtree::EntityPathKey entityPathKey(record.targetId);
+
+    if (_isolatableHWs.isKnownUnresolved(entityPathKey))
+    {
+        log<level::DEBUG>(
+            std::format("Skipping to restore a given isolated hardware [{}] : "
+                        "The inventory path is already failed to get",
+                        entityPathKey.toString())
+                .c_str());
+        return;
+    }
 
     try
     {
@@ -511,10 +588,10 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
         }
 
         bool ecoCore{
-            (_persistedEcoCores.contains(entityPathRawData) && isRestorePath)};
+            (_persistedEcoCores.contains(entityPathKey) && isRestorePath)};
 
         auto isolatedHwInventoryPath =
-            _isolatableHWs.getInventoryPath(entityPathRawData, ecoCore);
+            _isolatableHWs.getInventoryPath(entityPathKey, ecoCore);
 
         if (!isolatedHwInventoryPath.has_value())
         {
@@ -522,11 +599,12 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
                 std::format(
                     "Skipping to restore a given isolated "
                     "hardware [{}] : Due to failure to get inventory path",
-                    ss.str())
+                    entityPathKey.toString())
                     .c_str());
+            _isolatableHWs.setUnresolved(entityPathKey);
             return;
         }
-        updateEcoCoresList(ecoCore, entityPathRawData);
+        updateEcoCoresList(ecoCore, entityPathKey);
 
         auto bmcErrorLogPath = utils::getBMCLogPath(_bus, record.elogId);
         std::string strBmcErrorLogPath{};
@@ -540,7 +618,7 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
                 std::format("Skipping to restore a given isolated "
                             "hardware [{}] : Due to failure to to get BMC "
                             "EntrySeverity by isolated hardware GardType [{}]",
-                            ss.str(), record.errType)
+                            entityPathKey.toString(), record.errType)
                     .c_str());
             return;
         }
@@ -556,7 +634,7 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
                 std::format(
                     "Skipping to restore a given isolated "
                     "hardware [{}] : Due to failure to create dbus entry",
-                    ss.str())
+                    entityPathKey.toString())
                     .c_str());
             return;
         }
@@ -566,7 +644,7 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
         log<level::ERR>(
             std::format("Exception [{}] : Skipping to restore a given isolated "
                         "hardware [{}]",
-                        e.what(), ss.str())
+                        e.what(), entityPathKey.toString())
                 .c_str());
     }
 }
@@ -574,29 +652,34 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
 void Manager::updateEntryForRecord(const openpower_guard::GuardRecord& record,
                                    IsolatedHardwares::iterator& entryIt)
 {
-    auto entityPathRawData =
-        devtree::convertEntityPathIntoRawData(record.targetId);
-    std::stringstream ss;
-    std::for_each(entityPathRawData.begin(), entityPathRawData.end(),
-                  [&ss](const auto& ele) {
-        ss << std::setw(2) << std::setfill('0') << std::hex << (int)ele << " ";
-    });
+    const devtree::EntityPathKey entityPathKey(record.targetId);
+
+    if (_isolatableHWs.isKnownUnresolved(entityPathKey))
+    {
+        log<level::DEBUG>(
+            std::format("Skipping to restore a given isolated hardware [{}] : "
+                        "The inventory path is already failed to get",
+                        entityPathKey.toString())
+                .c_str());
+        return;
+    }
 
     bool ecoCore{false};
 
     auto isolatedHwInventoryPath =
-        _isolatableHWs.getInventoryPath(entityPathRawData, ecoCore);
+        _isolatableHWs.getInventoryPath(entityPathKey, ecoCore);
 
     if (!isolatedHwInventoryPath.has_value())
     {
         log<level::ERR>(
             std::format("Skipping to restore a given isolated "
                         "hardware [{}] : Due to failure to get inventory path",
-                        ss.str())
+                        entityPathKey.toString())
                 .c_str());
+        _isolatableHWs.setUnresolved(entityPathKey);
         return;
     }
-    updateEcoCoresList(ecoCore, entityPathRawData);
+    updateEcoCoresList(ecoCore, entityPathKey);
 
     auto bmcErrorLogPath = utils::getBMCLogPath(_bus, record.elogId);
 
@@ -608,7 +691,7 @@ void Manager::updateEntryForRecord(const openpower_guard::GuardRecord& record,
             std::format("Skipping to restore a given isolated "
                         "hardware [{}] : Due to failure to to get BMC "
                         "EntrySeverity by isolated hardware GardType [{}]",
-                        ss.str(), record.errType)
+                        entityPathKey.toString(), record.errType)
                 .c_str());
         return;
     }
@@ -660,81 +743,497 @@ void Manager::updateEntryForRecord(const openpower_guard::GuardRecord& record,
 
 void Manager::cleanupPersistedEcoCores()
 {
-    bool updated{false};
-    if (_isolatedHardwares.empty())
+    // Drop the eco cores which are no longer isolated in one pass.
+    auto erasedCount = std::erase_if(_persistedEcoCores,
+                                     [this](const auto& ecoCore) {
+        return !this->_entryIndex.contains(ecoCore);
+    });
+
+    if (erasedCount > 0)
     {
-        _persistedEcoCores.clear();
-        updated = true;
+        _ecoCoresDirty = true;
     }
-    else
+}
+
+void Manager::cleanupPersistedFiles()
+{
+    _entryJournal.retainIf([this](const auto& entryRecordId) {
+        return this->_isolatedHardwares.contains(entryRecordId);
+    });
+
+    // The entry persisted files are migrated into the entry journal
+    // in the restore path so, the remaining files are stale.
+    std::error_code ec;
+    fs::remove_all(fs::path(HW_ISOLATION_ENTRY_PERSIST_PATH).parent_path(), ec);
+
+    cleanupPersistedEcoCores();
+}
+
+void Manager::restoreFromSnapshotEntry(
+    const snapshot::SnapshotEntry& snapshotEntry)
+{
+    const devtree::EntityPathKey entityPathKey(snapshotEntry.entityPath.data(),
+                                               snapshotEntry.entityPath.size());
+
+    // The error log association is not taken from the snapshot since
+    // the error log might be deleted after the snapshot is taken and
+    // the logging state is not part of the snapshot key.
+    std::string strBmcErrorLogPath{};
+    auto bmcErrorLogPath = utils::getBMCLogPath(_bus, snapshotEntry.elogId);
+    if (bmcErrorLogPath.has_value())
     {
-        for (auto ecoCore = _persistedEcoCores.begin();
-             ecoCore != _persistedEcoCores.end();)
+        strBmcErrorLogPath = bmcErrorLogPath->str;
+    }
+
+    auto entryPath = createEntry(
+        snapshotEntry.recordId, snapshotEntry.resolved, snapshotEntry.severity,
+        snapshotEntry.isolatedHardware, strBmcErrorLogPath, false,
+        entityPathKey.toEntityPath());
+
+    if (!entryPath.has_value())
+    {
+        log<level::ERR>(
+            std::format("Skipping to restore a given isolated "
+                        "hardware [{}] : Due to failure to create dbus entry",
+                        entityPathKey.toString())
+                .c_str());
+        return;
+    }
+    updateEcoCoresList(snapshotEntry.ecoCore, entityPathKey);
+}
+
+void Manager::scheduleRestoreSnapshot(
+    const std::optional<snapshot::SnapshotKey>& snapshotKey,
+    const openpower_guard::GuardRecords& records)
+{
+    if (!snapshotKey.has_value())
+    {
+        return;
+    }
+
+    // The entry doesn't keep the error log id so, keeping the error log id
+    // of the records which are used to resolve the entries.
+    std::unordered_map<entry::EntryRecordId, uint32_t> elogIds;
+    std::ranges::for_each(records, [&elogIds](const auto& record) {
+        elogIds.emplace(record.recordId, record.elogId);
+    });
+
+    _groupCommit.schedule("restore_snapshot", [this, key = *snapshotKey,
+                                               elogIds = std::move(elogIds)]() {
+        snapshot::SnapshotEntries snapshotEntries;
+        snapshotEntries.reserve(this->_isolatedHardwares.size());
+
+        for (const auto& [recordId, entry] : this->_isolatedHardwares)
         {
-            auto nextEcoCore = std::next(ecoCore, 1);
+            auto elogId = elogIds.find(recordId);
+            if (elogId == elogIds.end())
+            {
+                // The entry is created after the records are read so,
+                // the snapshot won't be matched with the key.
+                return;
+            }
 
-            auto isNotIsolated = std::ranges::none_of(
-                _isolatedHardwares, [ecoCore](const auto& entry) {
-                return (entry.second->getEntityPath() ==
-                        openpower_guard::EntityPath(ecoCore->data(),
-                                                    ecoCore->size()));
-            });
+            snapshot::SnapshotEntry snapshotEntry;
+            snapshotEntry.recordId = recordId;
+            snapshotEntry.elogId = elogId->second;
+            snapshotEntry.resolved = entry->resolved();
+            snapshotEntry.severity = entry->severity();
+            snapshotEntry.ecoCore =
+                this->_persistedEcoCores.contains(entry->getEntityPathKey());
+            snapshotEntry.entityPath = entry->getEntityPathKey().toRawData();
 
-            if (isNotIsolated)
+            for (const auto& [fwdType, revType, path] : entry->associations())
             {
-                updateEcoCoresList(false, *ecoCore);
-                updated = true;
+                if (fwdType == "isolated_hw")
+                {
+                    snapshotEntry.isolatedHardware = path;
+                }
             }
+            snapshotEntries.push_back(std::move(snapshotEntry));
+        }
 
-            ecoCore = nextEcoCore;
+        auto encodedSnapshot = snapshot::encode(key, snapshotEntries);
+        if (encodedSnapshot.has_value())
+        {
+            this->_groupCommit.stageFile(
+                snapshot::HW_ISOLATION_RESTORE_SNAPSHOT_PATH, *encodedSnapshot);
         }
+    });
+}
+
+void Manager::restore()
+{
+    prefetch::RestoreScope restoreScope;
+
+    // Get the snapshot key before reading the records so that the snapshot
+    // won't be matched if the records are updated while restoring.
+    auto snapshotKey = snapshot::getSnapshotKey();
+    auto persistedSnapshot =
+        snapshot::load(snapshot::HW_ISOLATION_RESTORE_SNAPSHOT_PATH);
+
+    if (snapshotKey.has_value() && persistedSnapshot.has_value() &&
+        (persistedSnapshot->key == *snapshotKey))
+    {
+        std::ranges::for_each(persistedSnapshot->entries,
+                              [this](const auto& snapshotEntry) {
+            this->restoreFromSnapshotEntry(snapshotEntry);
+        });
+        finishRestore(std::nullopt);
+        return;
     }
 
-    if (updated)
+    // Don't get ephemeral records (GARD_Reconfig and GARD_Sticky_deconfig
+    // because those type records are created for internal purpose to use
+    // by BMC and Hostboot
+    _restoreRecords = openpower_guard::getAll(true);
+    _restoreSnapshotKey = snapshotKey;
+
+    // The entries which are not changed since the snapshot is taken
+    // are restored from the snapshot if the device tree is not changed
+    // and the remaining records will be resolved.
+    std::unordered_map<entry::EntryRecordId, const snapshot::SnapshotEntry*>
+        snapshotEntries;
+    if (snapshotKey.has_value() && persistedSnapshot.has_value() &&
+        (persistedSnapshot->key.devTreeHash == snapshotKey->devTreeHash))
     {
-        serialize();
+        std::ranges::for_each(persistedSnapshot->entries,
+                              [&snapshotEntries](const auto& snapshotEntry) {
+            snapshotEntries.emplace(snapshotEntry.recordId, &snapshotEntry);
+        });
     }
+
+    for (const auto& record : _restoreRecords)
+    {
+        if (!isValidRecord(record.recordId))
+        {
+            continue;
+        }
+
+        auto snapshotEntry = snapshotEntries.find(record.recordId);
+        if ((snapshotEntry != snapshotEntries.end()) &&
+            snapshot::isMatched(*snapshotEntry->second, record))
+        {
+            restoreFromSnapshotEntry(*snapshotEntry->second);
+        }
+        else
+        {
+            _pendingRestoreRecords.push_back(record);
+        }
+    }
+
+#ifdef PROGRESSIVE_STARTUP
+    // Resolve the remaining records from the event loop to allow
+    // the D-Bus name to be claimed with the restored entries.
+    if (!_pendingRestoreRecords.empty())
+    {
+        _restoreSource = std::make_unique<sdeventplus::source::Defer>(
+            _eventLoop, [this](sdeventplus::source::EventBase&) {
+            this->restorePendingRecords(restoreChunkSize);
+        });
+        return;
+    }
+#endif
+
+    restorePendingRecords(_pendingRestoreRecords.size());
 }
 
-void Manager::cleanupPersistedFiles()
+std::optional<Manager::RestoreRecord>
+    Manager::planRestoreRecord(const openpower_guard::GuardRecord& record)
 {
-    auto deletePersistedEntryFileIfNotExist = [this](const auto& file) {
-        auto fileEntryId = std::stoul(file.path().filename());
+    RestoreRecord restoreRecord;
+    restoreRecord.record = record;
+    restoreRecord.entityPathKey = devtree::EntityPathKey(record.targetId);
+    restoreRecord.ecoCore =
+        _persistedEcoCores.contains(restoreRecord.entityPathKey);
 
-        if (!(this->_isolatedHardwares.contains(fileEntryId)))
+    if (_isolatableHWs.isKnownUnresolved(restoreRecord.entityPathKey))
+    {
+        log<level::DEBUG>(
+            std::format("Skipping to restore a given isolated hardware [{}] : "
+                        "The inventory path is already failed to get",
+                        restoreRecord.entityPathKey.toString())
+                .c_str());
+        return std::nullopt;
+    }
+
+    auto plan = _isolatableHWs.getInventoryPathPlan(
+        restoreRecord.entityPathKey, restoreRecord.ecoCore);
+    if (!plan.has_value())
+    {
+        log<level::ERR>(
+            std::format("Skipping to restore a given isolated "
+                        "hardware [{}] : Due to failure to get inventory path",
+                        restoreRecord.entityPathKey.toString())
+                .c_str());
+        _isolatableHWs.setUnresolved(restoreRecord.entityPathKey);
+        return std::nullopt;
+    }
+    restoreRecord.plan = std::move(*plan);
+
+    auto entrySeverity = entry::utils::getEntrySeverityType(
+        static_cast<openpower_guard::GardType>(record.errType));
+    if (!entrySeverity.has_value())
+    {
+        log<level::ERR>(
+            std::format("Skipping to restore a given isolated "
+                        "hardware [{}] : Due to failure to to get BMC "
+                        "EntrySeverity by isolated hardware GardType [{}]",
+                        restoreRecord.entityPathKey.toString(), record.errType)
+                .c_str());
+        return std::nullopt;
+    }
+    restoreRecord.severity = *entrySeverity;
+
+    return restoreRecord;
+}
+
+void Manager::resolveRestoreRecords(std::vector<RestoreRecord>& restoreRecords)
+{
+    // Group the records by the parent FRU so that the parent FRU and
+    // its childs are looked up only once for all the records in the group.
+    std::map<std::optional<std::pair<type::LocationCode, type::InstanceId>>,
+             std::vector<RestoreRecord*>>
+        recordsByFru;
+    std::ranges::for_each(restoreRecords, [&recordsByFru](auto& restoreRecord) {
+        recordsByFru[restoreRecord.plan.fruDetails].push_back(&restoreRecord);
+    });
+
+    std::vector<std::vector<RestoreRecord*>> groups;
+    groups.reserve(recordsByFru.size());
+    for (auto& [fruDetails, records] : recordsByFru)
+    {
+        groups.push_back(std::move(records));
+    }
+
+    auto resolve = [this](sdbusplus::bus::bus& bus,
+                          std::vector<RestoreRecord*>& group) {
+        isolatable_hws::IsolatableHWs::ResolveCache cache;
+        for (auto restoreRecord : group)
         {
-            fs::remove(file.path());
+            if (restoreRecord->resolved)
+            {
+                continue;
+            }
+
+            restoreRecord->inventoryPath =
+                this->_isolatableHWs.resolveInventoryPath(
+                    bus, restoreRecord->plan, cache);
+            if (restoreRecord->inventoryPath.has_value())
+            {
+                restoreRecord->bmcErrorLog =
+                    utils::getBMCLogPath(bus, restoreRecord->record.elogId);
+            }
+            restoreRecord->resolved = true;
         }
     };
 
-    std::ranges::for_each(
-        fs::directory_iterator(
-            fs::path(HW_ISOLATION_ENTRY_PERSIST_PATH).parent_path()),
-        deletePersistedEntryFileIfNotExist);
+    auto workersCount = std::min(restoreWorkersCount, groups.size());
 
-    cleanupPersistedEcoCores();
+    // The bus connection cannot be shared between the threads so, using
+    // the private connection for each worker which is opened once and
+    // reused for all the chunks until the restore is finished.
+    try
+    {
+        while ((workersCount > 1) &&
+               (_restoreWorkerBuses.size() < workersCount))
+        {
+            _restoreWorkerBuses.emplace_back(sdbusplus::bus::new_bus());
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(
+            std::format("Exception [{}] to open the restore worker bus "
+                        "connection, using [{}] workers",
+                        e.what(), _restoreWorkerBuses.size())
+                .c_str());
+        workersCount = std::min(workersCount, _restoreWorkerBuses.size());
+    }
+
+    if (workersCount > 1)
+    {
+        std::atomic<std::size_t> nextGroup{0};
+        std::vector<std::future<void>> workers;
+        workers.reserve(workersCount);
+
+        for (std::size_t worker = 0; worker < workersCount; worker++)
+        {
+            workers.emplace_back(std::async(
+                std::launch::async,
+                [&groups, &nextGroup, &resolve,
+                 &bus = _restoreWorkerBuses[worker]]() {
+                prefetch::RestoreScope restoreScope;
+
+                for (auto index = nextGroup++; index < groups.size();
+                     index = nextGroup++)
+                {
+                    resolve(bus, groups[index]);
+                }
+            }));
+        }
+
+        for (auto& worker : workers)
+        {
+            try
+            {
+                worker.get();
+            }
+            catch (const std::exception& e)
+            {
+                log<level::ERR>(
+                    std::format("Exception [{}] in the restore worker, the "
+                                "remaining records will be resolved by using "
+                                "the attached bus",
+                                e.what())
+                        .c_str());
+            }
+        }
+    }
+
+    // Resolve the records which are not resolved by the workers
+    // (if any worker is failed) and if the workers are not used.
+    for (auto& group : groups)
+    {
+        resolve(_bus, group);
+    }
 }
 
-void Manager::restore()
+void Manager::createEntryForRestoreRecord(const RestoreRecord& restoreRecord)
 {
-    // Don't get ephemeral records (GARD_Reconfig and GARD_Sticky_deconfig
-    // because those type records are created for internal purpose to use
-    // by BMC and Hostboot
-    openpower_guard::GuardRecords records = openpower_guard::getAll(true);
+    const auto& record = restoreRecord.record;
 
-    auto validRecord = [this](const auto& record) {
-        return this->isValidRecord(record.recordId);
-    };
+    if (!restoreRecord.inventoryPath.has_value())
+    {
+        log<level::ERR>(
+            std::format("Skipping to restore a given isolated "
+                        "hardware [{}] : Due to failure to get inventory path",
+                        restoreRecord.entityPathKey.toString())
+                .c_str());
+        _isolatableHWs.setUnresolved(restoreRecord.entityPathKey);
+        return;
+    }
+    updateEcoCoresList(restoreRecord.ecoCore, restoreRecord.entityPathKey);
 
-    auto validRecords = records | std::views::filter(validRecord);
+    std::string strBmcErrorLogPath{};
+    if (restoreRecord.bmcErrorLog.has_value())
+    {
+        strBmcErrorLogPath = restoreRecord.bmcErrorLog->str;
+    }
 
-    auto createEntry = [this](const auto& record) {
-        this->createEntryForRecord(record, true);
-    };
+    entry::EntryResolved resolved = false;
+    if (record.recordId == 0xFFFFFFFF)
+    {
+        resolved = true;
+    }
+
+    auto entryPath = createEntry(record.recordId, resolved,
+                                 restoreRecord.severity,
+                                 restoreRecord.inventoryPath->str,
+                                 strBmcErrorLogPath, false, record.targetId);
+
+    if (!entryPath.has_value())
+    {
+        log<level::ERR>(
+            std::format("Skipping to restore a given isolated "
+                        "hardware [{}] : Due to failure to create dbus entry",
+                        restoreRecord.entityPathKey.toString())
+                .c_str());
+    }
+}
+
+void Manager::restorePendingRecords(const std::size_t maxRecords)
+{
+    prefetch::RestoreScope restoreScope;
+
+    // The devtree lookups are done in the main thread since the phal cec
+    // device tree cannot be accessed concurrently, the D-Bus lookups are done
+    // concurrently and the dbus entries are created in the main thread.
+    std::vector<RestoreRecord> restoreRecords;
+    for (std::size_t count = 0;
+         (count < maxRecords) && !_pendingRestoreRecords.empty(); count++)
+    {
+        auto record = std::move(_pendingRestoreRecords.front());
+        _pendingRestoreRecords.pop_front();
+
+        // The entry might be created by the reconciliation while restoring.
+        if (!isValidRecord(record.recordId) ||
+            _isolatedHardwares.contains(record.recordId))
+        {
+            continue;
+        }
+
+        auto restoreRecord = planRestoreRecord(record);
+        if (restoreRecord.has_value())
+        {
+            restoreRecords.push_back(std::move(*restoreRecord));
+        }
+    }
+
+    resolveRestoreRecords(restoreRecords);
+
+    std::ranges::for_each(restoreRecords, [this](const auto& restoreRecord) {
+        this->createEntryForRestoreRecord(restoreRecord);
+    });
+
+    if (_pendingRestoreRecords.empty())
+    {
+        if (_restoreSource)
+        {
+            _restoreSource->set_enabled(sdeventplus::source::Enabled::Off);
+        }
+
+        finishRestore(_restoreSnapshotKey);
+        _restoreRecords.clear();
+        _restoreSnapshotKey.reset();
+    }
+}
+
+void Manager::refreshPendingRestoreRecords(
+    const openpower_guard::GuardRecords& records)
+{
+    std::unordered_map<entry::EntryRecordId,
+                       const openpower_guard::GuardRecord*>
+        validRecords;
+    std::ranges::for_each(records, [this, &validRecords](const auto& record) {
+        if (this->isValidRecord(record.recordId))
+        {
+            validRecords.emplace(record.recordId, &record);
+        }
+    });
+
+    std::deque<openpower_guard::GuardRecord> pendingRestoreRecords;
+    for (const auto& pendingRecord : _pendingRestoreRecords)
+    {
+        auto validRecord = validRecords.find(pendingRecord.recordId);
+        if (validRecord == validRecords.end())
+        {
+            continue;
+        }
 
-    std::ranges::for_each(validRecords, createEntry);
+        // Use the current record since the record might be updated.
+        pendingRestoreRecords.push_back(*validRecord->second);
+    }
+    _pendingRestoreRecords = std::move(pendingRestoreRecords);
+}
 
+void Manager::finishRestore(
+    const std::optional<snapshot::SnapshotKey>& snapshotKey)
+{
     cleanupPersistedFiles();
+    flushEcoCores();
+    scheduleRestoreSnapshot(snapshotKey, _restoreRecords);
+
+    // The restore workers are not used after the restore.
+    _restoreWorkerBuses.clear();
+
+#ifdef PROGRESSIVE_STARTUP
+    // The prefetched D-Bus data is not required once all the isolated
+    // hardwares are restored (it is used only by the restore path so,
+    // the runtime paths are not affected until then).
+    prefetch::release();
+#endif
+
+    state(ServiceReadyInterface::States::Enabled);
 }
 
 void Manager::processHardwareIsolationRecordFile()
@@ -788,17 +1287,37 @@ void Manager::handleHostIsolatedHardwares()
         }
     }
 
+    auto snapshotKey = snapshot::getSnapshotKey();
+
     // Don't get ephemeral records (GARD_Reconfig and GARD_Sticky_deconfig
     // because those type records are created for internal purpose to use
     // by BMC and Hostboot
     openpower_guard::GuardRecords records = openpower_guard::getAll(true);
 
+    // The records which are not restored yet might be deleted or resolved
+    // while restoring so, those are revalidated against the current records
+    // and the snapshot is taken for the current records once restored.
+    bool restoreInProgress = !_pendingRestoreRecords.empty();
+    if (restoreInProgress)
+    {
+        refreshPendingRestoreRecords(records);
+        _restoreRecords = records;
+        _restoreSnapshotKey = snapshotKey;
+    }
+
     // Delete all the D-Bus entries if no record in their persisted location
     if ((records.size() == 0) && _isolatedHardwares.size() > 0)
     {
         // Clean up all entries association before delete.
         clearDbusEntries();
         _isolatedHardwares.clear();
+        _entryIndex.clear();
+        cleanupPersistedEcoCores();
+        flushEcoCores();
+        if (!restoreInProgress)
+        {
+            scheduleRestoreSnapshot(snapshotKey, records);
+        }
         return;
     }
 
@@ -806,51 +1325,43 @@ void Manager::handleHostIsolatedHardwares()
         return this->isValidRecord(record.recordId);
     };
 
+    // Index the valid records by their entity path to avoid iterating
+    // all the records for each entry.
+    std::unordered_map<devtree::EntityPathKey,
+                       std::vector<const openpower_guard::GuardRecord*>>
+        validRecordsIndex;
+    std::ranges::for_each(records | std::views::filter(validRecord),
+                          [&validRecordsIndex](const auto& record) {
+        validRecordsIndex[devtree::EntityPathKey(record.targetId)].push_back(
+            &record);
+    });
+
     for (auto entryIt = _isolatedHardwares.begin();
          entryIt != _isolatedHardwares.end();)
     {
         auto nextEntryIt = std::next(entryIt, 1);
 
-        auto entryRecord = [entryIt](const auto& record) {
-            return entryIt->second->getEntityPath() == record.targetId;
-        };
-        auto entryRecords = records | std::views::filter(entryRecord);
+        auto validEntryRecords =
+            validRecordsIndex.find(entryIt->second->getEntityPathKey());
 
-        if (entryRecords.empty())
+        if (validEntryRecords == validRecordsIndex.end())
         {
             entryIt->second->resolveEntry(false);
         }
+        else if (validEntryRecords->second.size() == 1)
+        {
+            this->updateEntryForRecord(*validEntryRecords->second.front(),
+                                       entryIt);
+        }
         else
         {
-            auto validEntryRecords = entryRecords |
-                                     std::views::filter(validRecord);
-
-            if (validEntryRecords.empty())
-            {
-                entryIt->second->resolveEntry(false);
-            }
-            else if (std::distance(validEntryRecords.begin(),
-                                   validEntryRecords.end()) == 1)
-            {
-                this->updateEntryForRecord(validEntryRecords.front(), entryIt);
-            }
-            else
-            {
-                // Should not happen since, more than one valid records
-                // for the same hardware is not allowed
-                auto entityPathRawData = devtree::convertEntityPathIntoRawData(
-                    entryIt->second->getEntityPath());
-                std::stringstream ss;
-                std::for_each(entityPathRawData.begin(),
-                              entityPathRawData.end(), [&ss](const auto& ele) {
-                    ss << std::setw(2) << std::setfill('0') << std::hex
-                       << (int)ele << " ";
-                });
-                log<level::ERR>(std::format("More than one valid records exist "
-                                            "for the same hardware [{}]",
-                                            ss.str())
-                                    .c_str());
-            }
+            // Should not happen since, more than one valid records
+            // for the same hardware is not allowed
+            log<level::ERR>(
+                std::format("More than one valid records exist "
+                            "for the same hardware [{}]",
+                            entryIt->second->getEntityPathKey().toString())
+                    .c_str());
         }
         entryIt = nextEntryIt;
     }
@@ -858,11 +1369,8 @@ void Manager::handleHostIsolatedHardwares()
     auto validRecords = records | std::views::filter(validRecord);
 
     auto createEntryIfNotExists = [this](const auto& validRecord) {
-        auto recordExist = [validRecord](const auto& entry) {
-            return validRecord.targetId == entry.second->getEntityPath();
-        };
-
-        if (std::ranges::none_of(this->_isolatedHardwares, recordExist))
+        if (!this->_entryIndex.contains(
+                devtree::EntityPathKey(validRecord.targetId)))
         {
             this->createEntryForRecord(validRecord);
         }
@@ -871,70 +1379,88 @@ void Manager::handleHostIsolatedHardwares()
     std::ranges::for_each(validRecords, createEntryIfNotExists);
 
     cleanupPersistedEcoCores();
+    flushEcoCores();
+
+    // The snapshot will be taken once the pending records are restored.
+    if (!restoreInProgress)
+    {
+        scheduleRestoreSnapshot(snapshotKey, records);
+    }
+
+    log<level::DEBUG>(std::format("Skipped [{}] unchanged entry writes",
+                                  entry::Entry::getSkippedWritesCount())
+                          .c_str());
 }
 
 std::optional<std::tuple<entry::EntrySeverity, entry::EntryErrLogPath>>
     Manager::getIsolatedHwRecordInfo(
         const sdbusplus::message::object_path& hwInventoryPath)
 {
-    // If there is more than one hw isolation entry matching the inventory
-    // The possibility of that is very less as we do not intend to create
-    // more than 1 record per physical dimm.
-    std::vector<hw_isolation::record::IsolatedHardwares::iterator>
-        entriesIterators;
+    auto hwsRecordInfo = getIsolatedHwsRecordInfo({hwInventoryPath.str});
 
-    // Make sure whether the given hardware inventory is exists
-    // in the record list.
-    for (auto it = _isolatedHardwares.begin(); it != _isolatedHardwares.end();
-         ++it)
-    {
-        if ([&it, hwInventoryPath]() {
-            for (const auto& assocEle : it->second->associations())
-            {
-                if (std::get<0>(assocEle) == "isolated_hw")
-                {
-                    return std::get<2>(assocEle) == hwInventoryPath.str;
-                }
-            }
-            return false;
-        }())
-        {
-            // Get all the HW Isolation entries that match the inventory path
-            // For Dimms, there could be more than one entry
-            entriesIterators.push_back(it);
-        }
-    }
     // inventory path  not found
-    if (entriesIterators.size() == 0)
+    if (hwsRecordInfo.empty())
     {
         return std::nullopt;
     }
+    return hwsRecordInfo.begin()->second;
+}
 
-    std::vector<entry::EntryErrLogPath> errLogPathList;
-    std::vector<entry::EntrySeverity> severityList;
+std::map<std::string, std::tuple<entry::EntrySeverity, entry::EntryErrLogPath>>
+    Manager::getIsolatedHwsRecordInfo(
+        const std::set<std::string>& hwInventoryPaths)
+{
+    // If there is more than one hw isolation entry matching the inventory
+    // The possibility of that is very less as we do not intend to create
+    // more than 1 record per physical dimm.
+    std::map<std::string, std::pair<std::vector<entry::EntrySeverity>,
+                                    std::vector<entry::EntryErrLogPath>>>
+        hwsEntriesInfo;
 
-    // Check which has highest priority and use it
-    for (auto entryIt : entriesIterators)
+    // Make sure whether the given hardwares inventory are exists
+    // in the record list.
+    for (const auto& [recordId, isolatedHw] : _isolatedHardwares)
     {
-        for (const auto& assocEle : entryIt->second->associations())
+        std::string isolatedHwPath;
+        entry::EntryErrLogPath errLogPath;
+        for (const auto& assocEle : isolatedHw->associations())
         {
-            if (std::get<0>(assocEle) == "isolated_hw_errorlog")
+            if (std::get<0>(assocEle) == "isolated_hw")
+            {
+                isolatedHwPath = std::get<2>(assocEle);
+            }
+            else if (std::get<0>(assocEle) == "isolated_hw_errorlog")
             {
-                errLogPathList.push_back(std::get<2>(assocEle));
-                break;
+                errLogPath = std::get<2>(assocEle);
             }
         }
-        severityList.push_back(entryIt->second->severity());
-        // No error log found for it. So push empty string
-        if (errLogPathList.size() != severityList.size())
+
+        if (!hwInventoryPaths.contains(isolatedHwPath))
         {
-            errLogPathList.push_back("");
+            continue;
         }
+
+        // Get all the HW Isolation entries that match the inventory path
+        // For Dimms, there could be more than one entry
+        // Note: The error log path will be empty string if no error log
+        //       found for it.
+        auto& hwEntriesInfo = hwsEntriesInfo[isolatedHwPath];
+        hwEntriesInfo.first.push_back(isolatedHw->severity());
+        hwEntriesInfo.second.push_back(errLogPath);
     }
 
-    // Now based on the priority get the Severity that needs to be used.
-    int index = getHigherPrecendenceEntry(severityList);
-    return std::make_tuple(severityList[index], errLogPathList[index]);
+    std::map<std::string,
+             std::tuple<entry::EntrySeverity, entry::EntryErrLogPath>>
+        hwsRecordInfo;
+    for (auto& [hwInventoryPath, hwEntriesInfo] : hwsEntriesInfo)
+    {
+        // Now based on the priority get the Severity that needs to be used.
+        int index = getHigherPrecendenceEntry(hwEntriesInfo.first);
+        hwsRecordInfo.emplace(hwInventoryPath,
+                              std::make_tuple(hwEntriesInfo.first[index],
+                                              hwEntriesInfo.second[index]));
+    }
+    return hwsRecordInfo;
 }
 
 int Manager::getHigherPrecendenceEntry(
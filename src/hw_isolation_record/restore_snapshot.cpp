@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config.h"
+
+#include "hw_isolation_record/restore_snapshot.hpp"
+
+#include "common/persist_utils.hpp"
+
+#include <sys/stat.h>
+
+#include <cereal/archives/binary.hpp>
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+
+namespace hw_isolation
+{
+namespace record
+{
+namespace snapshot
+{
+
+using namespace phosphor::logging;
+namespace fs = std::filesystem;
+
+/**
+ * The snapshot version must be changed if the snapshot members
+ * or the way to resolve the entries is changed.
+ */
+constexpr uint32_t snapshotVersion = 3;
+
+/**
+ * @brief Used to get the device tree hash
+ *
+ * @return the device tree hash on success
+ *         Empty optional if failed to get the device tree hash
+ *
+ * @note The device tree is large (multiple MBs) and it is not changed
+ *       as frequently as the hardware isolation records so, the hash is
+ *       recomputed only if the device tree file identity (inode, size and
+ *       modification time) is changed.
+ */
+static std::optional<uint64_t> getDevTreeHash()
+{
+    struct DevTreeHash
+    {
+        dev_t dev{0};
+        ino_t ino{0};
+        off_t size{0};
+        struct timespec mtime{};
+        uint64_t hash{0};
+    };
+    static std::optional<DevTreeHash> cachedHash;
+
+    struct stat fileStat;
+    if (stat(PHAL_DEVTREE, &fileStat) != 0)
+    {
+        cachedHash.reset();
+        return std::nullopt;
+    }
+
+    if (cachedHash.has_value() && (cachedHash->dev == fileStat.st_dev) &&
+        (cachedHash->ino == fileStat.st_ino) &&
+        (cachedHash->size == fileStat.st_size) &&
+        (cachedHash->mtime.tv_sec == fileStat.st_mtim.tv_sec) &&
+        (cachedHash->mtime.tv_nsec == fileStat.st_mtim.tv_nsec))
+    {
+        return cachedHash->hash;
+    }
+
+    auto devTreeHash = persist::hashFile(PHAL_DEVTREE);
+    if (!devTreeHash.has_value())
+    {
+        cachedHash.reset();
+        return std::nullopt;
+    }
+
+    cachedHash = DevTreeHash{fileStat.st_dev, fileStat.st_ino,
+                             fileStat.st_size, fileStat.st_mtim, *devTreeHash};
+    return devTreeHash;
+}
+
+std::optional<SnapshotKey> getSnapshotKey()
+{
+    auto guardFileHash =
+        persist::hashFile(openpower_guard::getGuardFilePath());
+    auto devTreeHash = getDevTreeHash();
+
+    if (!guardFileHash.has_value() || !devTreeHash.has_value())
+    {
+        return std::nullopt;
+    }
+    return SnapshotKey{*guardFileHash, *devTreeHash};
+}
+
+std::optional<Snapshot> load(const std::string& path)
+{
+    try
+    {
+        std::ifstream is(path, std::ios::in | std::ios::binary);
+        if (!is)
+        {
+            return std::nullopt;
+        }
+
+        cereal::BinaryInputArchive iarchive(is);
+
+        uint32_t persistedVersion{0};
+        iarchive(persistedVersion);
+
+        if (persistedVersion != snapshotVersion)
+        {
+            return std::nullopt;
+        }
+
+        Snapshot snapshot;
+        iarchive(snapshot.key, snapshot.entries);
+        return snapshot;
+    }
+    catch (const cereal::Exception& e)
+    {
+        log<level::ERR>(std::format("Exception: [{}] during load the "
+                                    "restore snapshot from {}",
+                                    e.what(), path)
+                            .c_str());
+        std::error_code ec;
+        fs::remove(path, ec);
+    }
+    return std::nullopt;
+}
+
+bool isMatched(const SnapshotEntry& snapshotEntry,
+               const openpower_guard::GuardRecord& record)
+{
+    if ((snapshotEntry.recordId != record.recordId) ||
+        (snapshotEntry.elogId != record.elogId))
+    {
+        return false;
+    }
+
+    if (devtree::EntityPathKey(record.targetId).toRawData() !=
+        snapshotEntry.entityPath)
+    {
+        return false;
+    }
+
+    auto entrySeverity = entry::utils::getEntrySeverityType(
+        static_cast<openpower_guard::GardType>(record.errType));
+    return entrySeverity.has_value() &&
+           (*entrySeverity == snapshotEntry.severity);
+}
+
+std::optional<std::string> encode(const SnapshotKey& snapshotKey,
+                                  const SnapshotEntries& snapshotEntries)
+{
+    try
+    {
+        std::ostringstream os(std::ios::binary);
+        {
+            cereal::BinaryOutputArchive oarchive(os);
+            oarchive(snapshotVersion, snapshotKey, snapshotEntries);
+        }
+        return os.str();
+    }
+    catch (const cereal::Exception& e)
+    {
+        log<level::ERR>(std::format("Exception: [{}] during encode the "
+                                    "restore snapshot",
+                                    e.what())
+                            .c_str());
+    }
+    return std::nullopt;
+}
+
+} // namespace snapshot
+} // namespace record
+} // namespace hw_isolation